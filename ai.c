@@ -1,9 +1,18 @@
+#define _POSIX_C_SOURCE 200112L
 #include "ai.h"
 #include "sow_and_capture.h"
+#include "zobrist.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 
 // GESTION DE LA MÉMOIRE (Table de Transpo)
@@ -11,80 +20,239 @@
 // perdre de temps à refaire le même travail si on retombe dessus.
 
 
-// On prévoit un max de graines pour le hachage pour éviter les débordements
-#define MAX_SEEDS_PER_HOLE 50
-
-// Tableaux de nombres aléatoires pour le Zobrist Hashing
-// Chaque pièce, chaque trou, chaque score a un nombre unique associé
-static uint64_t zobrist_keys[N_HOLES][3][MAX_SEEDS_PER_HOLE];
-static uint64_t zobrist_player[2];        
-static uint64_t zobrist_scores[3][100];   
-static uint64_t zobrist_half_moves[101];  
+// Les clés Zobrist sont des constantes générées à la compilation (zobrist.h)
+// => rien à calculer au lancement, et les clés sont les mêmes à chaque fois
 
 // La table principale
 static TranspositionTable tt;
 
-// Graine pour notre générateur de nombres aléatoires rapide 
-static uint64_t xorshift64_state = 0x123456789ABCDEF0ULL;
+// Stockage de la table : en BSS, donc mis à zéro par le système au chargement
+// (les pages ne sont réellement allouées qu'au premier accès)
+static TTSlot tt_storage[TT_SIZE];
+
+// Génération courante (incrémentée à chaque ouverture de la table sur disque)
+static uint8_t tt_generation = 0;
+
+// FORMAT COMPACT D'UNE ENTRÉE (champ data, 64 bits)
+// bits 0-7 profondeur | 8-39 score | 40-41 type | 42-46 trou | 47-48 couleur | 49 valide | 56-63 âge
 
-// Petit générateur aléatoire très rapide (plus rapide que rand())
-// https://en.wikipedia.org/wiki/Xorshift
+static inline uint64_t tt_pack(int depth, int score, TTEntryType type, AIMove move) {
+    return (uint64_t)(uint8_t)(int8_t)depth |
+           ((uint64_t)(uint32_t)score << 8) |
+           ((uint64_t)type << 40) |
+           ((uint64_t)(move.hole & 31) << 42) |
+           ((uint64_t)(move.color & 3) << 47) |
+           (1ULL << 49) |
+           ((uint64_t)tt_generation << 56);
+}
+
+static inline void tt_unpack(uint64_t key, uint64_t data, TTEntry* e) {
+    e->zobrist_key = key;
+    e->depth = (int8_t)(data & 0xFF);
+    e->score = (int32_t)(uint32_t)(data >> 8);
+    e->type = (TTEntryType)((data >> 40) & 3);
+    e->best_move.hole = (int)((data >> 42) & 31);
+    e->best_move.color = (Color)((data >> 47) & 3);
+    e->valid = (data >> 49) & 1;
+    e->age = (uint8_t)(data >> 56);
+}
 
-static uint64_t xorshift64(void) {
-    uint64_t x = xorshift64_state;
-    x ^= x << 13;
-    x ^= x >> 7;
-    x ^= x << 17;
-    xorshift64_state = x;
-    return x;
+// Lecture/écriture d'un slot en deux mots de 64 bits indivisibles : un autre processus
+// peut écrire en même temps, la vérification key_xor ^ data == clé rattrape ce cas
+static inline void tt_read_slot(const TTSlot* slot, uint64_t* key_xor, uint64_t* data) {
+    *data = __atomic_load_n(&slot->data, __ATOMIC_RELAXED);
+    *key_xor = __atomic_load_n(&slot->key_xor, __ATOMIC_RELAXED);
 }
 
+static inline void tt_write_slot(TTSlot* slot, uint64_t key, uint64_t data) {
+    __atomic_store_n(&slot->data, data, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->key_xor, key ^ data, __ATOMIC_RELAXED);
+}
+
+// TABLE PROJETÉE EN MÉMOIRE (fichier persistant ou mémoire partagée)
+// Un en-tête de 64 octets puis les TT_SIZE slots. Les entrées sont écrites
+// directement dans la projection pendant la recherche.
+
+#define TT_FILE_MAGIC "AWALETT"
+#define TT_FILE_VERSION 2
+#define TT_FILE_MIN_DEPTH 6   // En dessous, l'entrée ne vaut pas la peine d'être gardée
+#define TT_FILE_MAX_AGE 16    // Entrées plus vieilles (en sessions) jetées au chargement
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t entry_size;
+    uint32_t entry_count;
+    uint32_t generation;
+    uint64_t zobrist_seed;   // Les clés doivent être les mêmes que celles du fichier
+    uint8_t reserved[32];
+} TTFileHeader;
+
+static void* tt_map = NULL;
+static size_t tt_map_size = 0;
+static bool tt_shared = false;   // Table partagée : d'autres processus cherchent dedans
+
 // Initialise tout le système de mémoire au début du programme
 void tt_init(void) {
-    // On mélange la graine avec l'heure pour que ce soit différent à chaque fois
-    xorshift64_state = (uint64_t)time(NULL) ^ 0x123456789ABCDEF0ULL;
-    
-    // On remplit les tableaux avec des nombres aléatoires
-    for (int hole = 0; hole < N_HOLES; hole++) {
-        for (int seed_type = 0; seed_type < 3; seed_type++) {
-            for (int count = 0; count < MAX_SEEDS_PER_HOLE; count++) {
-                zobrist_keys[hole][seed_type][count] = xorshift64();
-            }
+    tt.slots = tt_storage;
+    tt.hits = 0; tt.misses = 0; tt.collisions = 0;
+}
+
+#ifndef _WIN32
+
+// Au chargement du fichier on ne garde que ce qui est profond et récent
+static int tt_filter_entries(void) {
+    int kept = 0;
+    for (int i = 0; i < TT_SIZE; i++) {
+        TTEntry e;
+        tt_unpack(0, tt.slots[i].data, &e);
+        if (!e.valid) continue;
+        if (e.depth < TT_FILE_MIN_DEPTH || (uint8_t)(tt_generation - e.age) > TT_FILE_MAX_AGE) {
+            memset(&tt.slots[i], 0, sizeof(TTSlot));
+        } else {
+            kept++;
         }
     }
-    
-    zobrist_player[0] = xorshift64();
-    zobrist_player[1] = xorshift64();
-    
-    for (int player = 0; player < 3; player++) {
-        for (int score = 0; score < 100; score++) {
-            zobrist_scores[player][score] = xorshift64();
-        }
+    return kept;
+}
+
+// Verrou exclusif sur tout le fichier (fcntl, libéré à la fermeture du descripteur) :
+// un seul processus à la fois crée ou vérifie l'en-tête
+static bool tt_lock_fd(int fd) {
+    struct flock lock = {0};
+    lock.l_type = F_WRLCK;
+    lock.l_whence = SEEK_SET;
+    while (fcntl(fd, F_SETLKW, &lock) != 0) {
+        if (errno != EINTR) return false;
     }
-    
-    for (int i = 0; i <= 100; i++) {
-        zobrist_half_moves[i] = xorshift64();
+    return true;
+}
+
+static bool tt_header_valid(const TTFileHeader* header) {
+    return memcmp(header->magic, TT_FILE_MAGIC, sizeof(header->magic)) == 0 &&
+           header->version == TT_FILE_VERSION && header->entry_size == sizeof(TTSlot) &&
+           header->entry_count == TT_SIZE && header->zobrist_seed == ZOBRIST_SEED;
+}
+
+static void tt_header_write(TTFileHeader* header) {
+    header->version = TT_FILE_VERSION;
+    header->entry_size = sizeof(TTSlot);
+    header->entry_count = TT_SIZE;
+    header->zobrist_seed = ZOBRIST_SEED;
+    header->generation = 0;
+    memcpy(header->magic, TT_FILE_MAGIC, sizeof(header->magic));
+}
+
+// Projette fd en mémoire, sous le verrou. Un fichier vide (ou jamais initialisé) reçoit un
+// en-tête neuf. Un en-tête d'une autre version, taille ou jeu de clés est remis à zéro
+// si reset, refusé sinon : on n'efface jamais une table partagée que d'autres utilisent.
+// Renvoie l'en-tête ou NULL
+static TTFileHeader* tt_map_fd(int fd, bool reset) {
+    size_t size = sizeof(TTFileHeader) + (size_t)TT_SIZE * sizeof(TTSlot);
+    if (!tt_lock_fd(fd)) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) return NULL;
+    bool empty = (st.st_size == 0);
+    if (!empty && (size_t)st.st_size != size && !reset) return NULL;
+    // Les pages ajoutées par ftruncate sont à zéro
+    if ((size_t)st.st_size != size && ftruncate(fd, (off_t)size) != 0) return NULL;
+
+    void* map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) return NULL;
+
+    TTFileHeader* header = (TTFileHeader*)map;
+    static const char no_magic[sizeof(header->magic)] = {0};
+    if (empty) {
+        tt_header_write(header);
+    } else if (!tt_header_valid(header)) {
+        if (reset) {
+            memset(map, 0, size);
+        } else if (memcmp(header->magic, no_magic, sizeof(header->magic)) != 0) {
+            munmap(map, size);
+            return NULL;
+        }
+        // Sans magic, le créateur s'est arrêté avant l'en-tête : personne n'a pu s'y attacher
+        tt_header_write(header);
     }
-    
-    // On alloue la mémoire pour la table de transposition
-    tt.entries = (TTEntry*)calloc(TT_SIZE, sizeof(TTEntry));
-    if (!tt.entries) exit(1); // Erreur critique si plus de RAM
-    
+
+    tt_cleanup();
+    tt_map = map;
+    tt_map_size = size;
+    tt.slots = (TTSlot*)((char*)map + sizeof(TTFileHeader));
     tt.hits = 0; tt.misses = 0; tt.collisions = 0;
+    return header;
+}
+
+bool tt_open_file(const char* path) {
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return false;
+    TTFileHeader* header = tt_map_fd(fd, true);
+    int kept = 0;
+    if (header) {
+        header->generation++;
+        tt_generation = (uint8_t)header->generation;
+        kept = tt_filter_entries();
+    }
+    close(fd); // Libère le verrou ; la projection reste valide sans le descripteur
+    if (!header) return false;
+
+    fprintf(stderr, "TT fichier %s : generation %u, %d entrees gardees\n",
+            path, (unsigned)header->generation, kept);
+    return true;
 }
 
+// Mémoire partagée : tous les processus lisent et écrivent la même table en direct,
+// sans filtrage ni changement de génération. Le premier processus crée l'en-tête ;
+// les suivants le vérifient seulement et refusent la table s'il ne correspond pas
+bool tt_open_shared(const char* name) {
+    int fd = shm_open(name, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return false;
+    TTFileHeader* header = tt_map_fd(fd, false);
+    if (header) tt_generation = (uint8_t)header->generation;
+    close(fd);
+    if (!header) {
+        fprintf(stderr, "TT partagee %s : en-tete incompatible ou illisible\n", name);
+        return false;
+    }
+
+    tt_shared = true;
+    fprintf(stderr, "TT partagee %s\n", name);
+    return true;
+}
+
+#else
+
+// Pas de mmap/shm_open sous Windows : on reste sur la table en mémoire
+bool tt_open_file(const char* path) {
+    (void)path;
+    return false;
+}
+
+bool tt_open_shared(const char* name) {
+    (void)name;
+    return false;
+}
+
+#endif // _WIN32
+
 // Libère la mémoire à la fin
 void tt_cleanup(void) {
-    if (tt.entries) {
-        free(tt.entries);
-        tt.entries = NULL;
+#ifndef _WIN32
+    if (tt_map) {
+        munmap(tt_map, tt_map_size); // Le noyau écrit les pages modifiées dans le fichier
+        tt_map = NULL;
     }
+    tt_shared = false;
+#endif
+    tt.slots = NULL;
 }
 
 // Vide la table (=> si on veut reset entre deux parties par ex)
+// Une table partagée n'est jamais vidée : d'autres processus cherchent avec ses entrées
 void tt_clear(void) {
-    if (tt.entries) {
-        memset(tt.entries, 0, TT_SIZE * sizeof(TTEntry));
+    if (tt.slots) {
+        if (!tt_shared) memset(tt.slots, 0, TT_SIZE * sizeof(TTSlot));
         tt.hits = 0; tt.misses = 0; tt.collisions = 0;
     }
 }
@@ -111,62 +279,143 @@ uint64_t zobrist_hash(const Board* board, int player, const int scores[3]) {
     
     // On ajoute l'info du score
     for (int p = 1; p <= 2; p++) {
-        if (scores[p] > 0 && scores[p] < 100) 
+        if (scores[p] > 0 && scores[p] < ZOBRIST_MAX_SCORE) 
             hash ^= zobrist_scores[p][scores[p]];
     }
     
     return hash;
 }
 
+// SYMÉTRIE PAR ROTATION
+// Les règles ne dépendent que des positions relatives des trous et de leur parité :
+// tourner le plateau de k trous donne une position équivalente, avec les joueurs échangés
+// (et leurs scores) si k est impair, puisque J1 a les indices pairs et J2 les impairs.
+// La forme canonique est la rotation qui donne la plus petite suite de trous ; toutes les
+// versions tournées d'une position tombent ainsi sur la même entrée de la TT.
+// Le score stocké est du point de vue du joueur au trait, il n'a pas à être traduit ;
+// seul le meilleur coup est décalé de la rotation.
+
+static inline uint32_t hole_signature(const Hole* h) {
+    return ((uint32_t)h->red << 16) | ((uint32_t)h->blue << 8) | (uint32_t)h->transparent;
+}
+
+// Plus petite rotation (ordre lexicographique sur les signatures des trous)
+static int canonical_rotation(const Board* board) {
+    uint32_t sig[N_HOLES];
+    for (int i = 0; i < N_HOLES; i++) sig[i] = hole_signature(&board->holes[i]);
+    
+    int best = 0;
+    for (int r = 1; r < N_HOLES; r++) {
+        for (int k = 0; k < N_HOLES; k++) {
+            uint32_t a = sig[(r + k) & (N_HOLES - 1)];
+            uint32_t b = sig[(best + k) & (N_HOLES - 1)];
+            if (a != b) {
+                if (a < b) best = r;
+                break;
+            }
+        }
+    }
+    return best;
+}
+
+uint64_t zobrist_hash_canonical(const Board* board, int player, const int scores[3], int* rotation) {
+    int r = canonical_rotation(board);
+    *rotation = r;
+    uint64_t hash = 0;
+    
+    // Le trou i de la position devient le trou i - r de la position canonique
+    for (int i = 0; i < N_HOLES; i++) {
+        const Hole* h = &board->holes[i];
+        int j = (i - r) & (N_HOLES - 1);
+        
+        if (h->red > 0 && h->red < MAX_SEEDS_PER_HOLE) 
+            hash ^= zobrist_keys[j][0][h->red];
+        if (h->blue > 0 && h->blue < MAX_SEEDS_PER_HOLE) 
+            hash ^= zobrist_keys[j][1][h->blue];
+        if (h->transparent > 0 && h->transparent < MAX_SEEDS_PER_HOLE) 
+            hash ^= zobrist_keys[j][2][h->transparent];
+    }
+    
+    // Rotation impaire : les camps sont échangés
+    bool swap = (r & 1);
+    hash ^= zobrist_player[swap ? 2 - player : player - 1];
+    
+    for (int p = 1; p <= 2; p++) {
+        if (scores[p] > 0 && scores[p] < ZOBRIST_MAX_SCORE) 
+            hash ^= zobrist_scores[swap ? 3 - p : p][scores[p]];
+    }
+    
+    return hash;
+}
+
+// Coup de la position réelle -> coup dans la position canonique (et inversement)
+AIMove tt_move_to_canonical(AIMove move, int rotation) {
+    if (move.hole != 0) move.hole = ((move.hole - 1 - rotation) & (N_HOLES - 1)) + 1;
+    return move;
+}
+
+AIMove tt_move_from_canonical(AIMove move, int rotation) {
+    if (move.hole != 0) move.hole = ((move.hole - 1 + rotation) & (N_HOLES - 1)) + 1;
+    return move;
+}
+
+// Stats de la table (trouvés, ratés, conflits) depuis le dernier tt_clear()
+void tt_get_stats(uint64_t* hits, uint64_t* misses, uint64_t* collisions) {
+    *hits = tt.hits;
+    *misses = tt.misses;
+    *collisions = tt.collisions;
+}
+
 // Cherche si une position existe déjà dans la table
-// Renvoie true si on a trouvé quelque chose d'utile
+// Renvoie true si on a trouvé quelque chose d'utile ; sinon result->best_move est le coup
+// de l'entrée (même trop peu profonde) ou hole 0
 bool tt_probe(uint64_t zobrist_key, int depth, int alpha, int beta, TTEntry* result) {
-    uint64_t index = zobrist_key % TT_SIZE;
-    TTEntry* entry = &tt.entries[index];
+    uint64_t key_xor, data;
+    tt_read_slot(&tt.slots[zobrist_key % TT_SIZE], &key_xor, &data);
     
-    // Vérifie si l'entrée est valide et correspond bien à notre position (pas de collision)
-    if (!entry->valid || entry->zobrist_key != zobrist_key) {
+    // Vérifie si l'entrée est valide et correspond bien à notre position (pas de collision,
+    // pas d'écriture à moitié faite par un autre processus)
+    if (data == 0 || (key_xor ^ data) != zobrist_key) {
         tt.misses++;
+        result->best_move.hole = 0;
         return false;
     }
     
+    // On renvoie l'entrée même si elle est trop peu profonde : son coup sert au tri
+    tt_unpack(zobrist_key, data, result);
+    
     // Si la position stockée a été calculée moins profondément que ce qu'on veut, ça ne suffit pas
-    if (entry->depth < depth) {
+    if (result->depth < depth) {
         tt.misses++;
         return false;
     }
     
     tt.hits++;
-    *result = *entry;
     
     // On vérifie si le score stocké est utilisable par rapport à alpha/beta
-    switch (entry->type) {
+    switch (result->type) {
         case EXACT: return true;
-        case LOWER_BOUND: return (entry->score >= beta);
-        case UPPER_BOUND: return (entry->score <= alpha);
+        case LOWER_BOUND: return (result->score >= beta);
+        case UPPER_BOUND: return (result->score <= alpha);
     }
     return false;
 }
 
 // Sauvegarde une position et son score dans la table
 void tt_store(uint64_t zobrist_key, int depth, int score, TTEntryType type, AIMove best_move) {
-    uint64_t index = zobrist_key % TT_SIZE;
-    TTEntry* entry = &tt.entries[index];
+    TTSlot* slot = &tt.slots[zobrist_key % TT_SIZE];
+    uint64_t key_xor, data;
+    tt_read_slot(slot, &key_xor, &data);
     
     // Stratégie de remplacement : on garde toujours la position qui a été cherchée le plus profondément
-    if (entry->valid && entry->zobrist_key != zobrist_key) {
-        if (entry->depth > depth) {
+    if (data != 0 && (key_xor ^ data) != zobrist_key) {
+        if ((int8_t)(data & 0xFF) > depth) {
             tt.collisions++;
             return; // On ne remplace pas une info plus précieuse (= plus profonde)
         }
     }
     
-    entry->zobrist_key = zobrist_key;
-    entry->depth = depth;
-    entry->score = score;
-    entry->type = type;
-    entry->best_move = best_move;
-    entry->valid = true;
+    tt_write_slot(slot, zobrist_key, tt_pack(depth, score, type, best_move));
 }
 
 
@@ -210,23 +459,53 @@ int generate_legal_moves(const Board* board, int player, AIMove* moves) {
     return count;
 }
 
+// Variante spécialisée : on ne parcourt que les 8 trous du joueur,
+// la vérification de camp de valid_move disparaît
+static FORCE_INLINE int generate_moves_side(const Board* board, int player, AIMove* moves) {
+    int count = 0;
+
+    for (int i = player - 1; i < 16; i += 2) {
+        const Hole* h = &board->holes[i];
+        if (h->red > 0) moves[count++] = (AIMove){i + 1, RED};
+        if (h->blue > 0) moves[count++] = (AIMove){i + 1, BLUE};
+        if (h->transparent > 0) {
+            moves[count++] = (AIMove){i + 1, T_AS_RED};
+            moves[count++] = (AIMove){i + 1, T_AS_BLUE};
+        }
+    }
+    return count;
+}
+
+int generate_legal_moves_p1(const Board* board, AIMove* moves) {
+    return generate_moves_side(board, 1, moves);
+}
+
+int generate_legal_moves_p2(const Board* board, AIMove* moves) {
+    return generate_moves_side(board, 2, moves);
+}
+
 // Applique un coup sur une copie du jeu (pour simuler le futur)
+// Mêmes règles que l'arbitre : affamation, compteur de coups (limite 400), etc.
 bool apply_move(GameState* game, AIMove move) {
-    Board temp_board = game->board;
-    int score_gain = 0;
-    int hole_index = move.hole - 1; // On repasse en index tableau 0-15
-    
-    // On utilise la logique du jeu (semis + captures)
-    if (!sow_and_capture(&temp_board, hole_index, move.color, &score_gain, game->current)) {
-        return false;
+    return game_play(game, move.hole - 1, move.color) != 0;
+}
+
+bool apply_move_p1(GameState* game, AIMove move) {
+    return game_play_p1(game, move.hole - 1, move.color) != 0;
+}
+
+bool apply_move_p2(GameState* game, AIMove move) {
+    return game_play_p2(game, move.hole - 1, move.color) != 0;
+}
+
+void expand_moves(const Board* board, const AIMove* moves, int n, SownMove* out) {
+    int starts[64];
+    Color colors[64];
+    for (int i = 0; i < n; i++) {
+        starts[i] = moves[i].hole - 1;
+        colors[i] = moves[i].color;
     }
-    
-    // Si ça marche, on met à jour l'état
-    game->board = temp_board;
-    game->score[game->current] += score_gain;
-    game->current = (game->current == 1) ? 2 : 1; // Changement de joueur
-    
-    return true;
+    sow_moves(board, starts, colors, n, out);
 }
 
 // Petit util pour l'affichage (Debug)
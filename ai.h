@@ -27,6 +27,26 @@ typedef struct {
     bool use_transposition_table;  
 } AIConfig;
 
+// Infos envoyées à la fin de chaque itération de la recherche
+typedef struct {
+    int depth;
+    int score;
+    uint64_t nodes;
+    int time_ms;
+    AIMove best_move;
+} SearchInfo;
+
+// Limites d'une recherche (0 = pas de limite)
+typedef struct {
+    int depth;                              // Profondeur max
+    int movetime_ms;                        // Temps max en ms
+    uint64_t nodes;                         // Nombre max de noeuds
+    volatile bool* stop;                    // Drapeau d'arrêt externe (commande "stop"), peut être NULL
+    void (*report)(const SearchInfo* info); // Appelé après chaque itération, peut être NULL
+    const AIMove* exclude;                  // Coups ignorés à la racine (multipv), peut être NULL
+    int n_exclude;
+} SearchLimits;
+
 // TABLE DE TRANSPOSITION 
 
 
@@ -45,13 +65,22 @@ typedef struct {
     TTEntryType type;       // Type de résultat
     AIMove best_move;       // Meilleur coup à jouer
     bool valid;             // Case occupée ?
+    uint8_t age;            // Génération (session) qui a écrit l'entrée
 } TTEntry;
 
 // Taille de la table : 1 million d'entrées
 #define TT_SIZE (1 << 20)
 
+// Entrée compacte réellement stockée (16 octets) : la clé est mélangée aux données
+// (key_xor = clé ^ data) pour détecter sans verrou une entrée à moitié écrite par un
+// autre processus quand la table est partagée
+typedef struct {
+    uint64_t key_xor;
+    uint64_t data;
+} TTSlot;
+
 typedef struct {
-    TTEntry* entries;
+    TTSlot* slots;
     uint64_t hits;        // Stats : trouvés
     uint64_t misses;      // Stats : ratés
     uint64_t collisions;  // Stats : conflits
@@ -61,11 +90,29 @@ typedef struct {
 
 void tt_init(void);      // Allouer
 void tt_cleanup(void);   // Libérer
-void tt_clear(void);     // Vider
+void tt_clear(void);     // Vider (sans effet sur une table partagée : seuls les compteurs repartent à zéro)
+
+// Table persistante sur disque (mmap) : garde les entrées profondes d'une partie
+// et d'un processus à l'autre. Renvoie false si impossible (la table en mémoire reste utilisée)
+bool tt_open_file(const char* path);
+
+// Table partagée entre tous les processus du bot sur la machine (mémoire partagée POSIX,
+// ex. nom "/awale_tt"). Le premier processus l'initialise, les suivants vérifient l'en-tête.
+// Renvoie false si impossible ou si l'en-tête ne correspond pas (la table en mémoire reste utilisée)
+bool tt_open_shared(const char* name);
 
 // Hashage Zobrist
 uint64_t zobrist_hash(const Board* board, int player, const int scores[3]);
 
+// Hash identique pour une position et toutes ses rotations (une rotation impaire
+// échange les joueurs). rotation = décalage vers la position canonique
+uint64_t zobrist_hash_canonical(const Board* board, int player, const int scores[3], int* rotation);
+AIMove tt_move_to_canonical(AIMove move, int rotation);
+AIMove tt_move_from_canonical(AIMove move, int rotation);
+
+// Stats de la table depuis le dernier tt_clear()
+void tt_get_stats(uint64_t* hits, uint64_t* misses, uint64_t* collisions);
+
 // Vérifier si une position existe
 bool tt_probe(uint64_t zobrist_key, int depth, int alpha, int beta, TTEntry* result);
 
@@ -80,6 +127,17 @@ int generate_legal_moves(const Board* board, int player, AIMove* moves);
 // Simuler un coup (renvoie false si impossible)
 bool apply_move(GameState* game, AIMove move);
 
+// Variantes spécialisées sur le joueur au trait (trous possédés connus à la compilation)
+// Mêmes coups dans le même ordre que les versions génériques
+int generate_legal_moves_p1(const Board* board, AIMove* moves);
+int generate_legal_moves_p2(const Board* board, AIMove* moves);
+bool apply_move_p1(GameState* game, AIMove move);
+bool apply_move_p2(GameState* game, AIMove move);
+
+// Expansion groupée : plateau, gain et trou d'arrivée de chaque coup en une passe (sow_moves),
+// à jouer ensuite avec game_play_sown
+void expand_moves(const Board* board, const AIMove* moves, int n, SownMove* out);
+
 // Debug affichage couleur
 const char* color_to_string(Color c);
 
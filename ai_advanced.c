@@ -1,6 +1,11 @@
 #include "ai_interface.h"
 #include "ai.h"
+#include "ai_advanced.h"
+#include "eval_params.h"
 #include "sow_and_capture.h"
+#include "profiler.h"
+#include "trace.h"
+#include "pn_search.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -16,18 +21,77 @@
 // Nombre de killer moves qu'on garde en mémoire par profondeur
 #define MAX_KILLER_MOVES 2
 
+// Profondeur restante minimale pour trier les captures par échange statique
+#define SEE_MIN_DEPTH 3
+
 // Valeurs pour l'infini et la victoire
 #define INFINITY_SCORE 1000000
 #define WIN_SCORE 100000
 
+// Victoire prouvée par le solveur (longueur inconnue) : au-dessus du seuil d'arrêt
+// de l'iterative deepening, et stockée à une profondeur qu'aucune recherche n'atteint
+#define PROVEN_WIN_SCORE (WIN_SCORE - 99)
+#define PROVEN_DEPTH 127
+
 // Variables pour gérer le temps de réflexion
 static clock_t search_end_time;
-static bool stop_search = false;
+static bool use_time_limit = true;
+static volatile bool stop_search = false;
+
+// Limites externes (commande "go" : noeuds max, drapeau "stop")
+static uint64_t node_limit = 0;
+static volatile bool* external_stop = NULL;
+
+// Coups ignorés à la racine (multipv) : la racine ne lit ni n'écrit la TT,
+// son score n'est pas celui de la position
+static const AIMove* root_exclude = NULL;
+static int root_n_exclude = 0;
 
 // Tableaux pour les heuristiques de tri 
 static AIMove killer_moves[MAX_DEPTH][MAX_KILLER_MOVES];
 static int history_scores[16][4];
 
+// Racine de la recherche précédente (alignement des killers), -1 : aucune
+static int last_root_moves = -1;
+static int last_root_player = 0;
+
+// Historique des captures, indexé par le coup (trou, couleur) et la taille de la rafle,
+// borné à +/- ORDER_HISTORY_MAX
+#define MOVE_INDEXES 64
+#define CAPTURE_BUCKETS 16
+#define ORDER_HISTORY_MAX 16384
+static int capture_history[MOVE_INDEXES][CAPTURE_BUCKETS];
+
+// Élagage sélectif (cf. ai_advanced.h) : marges en points d'évaluation (une graine
+// d'écart au score vaut 100 à 200), 0 = désactivé. Futility : +38 +/- 33 Elo (95 %) contre
+// sans élagage, 400 parties à 20 ms/coup (bench.exe match). Razoring et ProbCut sont coupés
+// par défaut : sur les positions du bench ils ne gagnent pas de noeuds (ProbCut en ajoute)
+PruneConfig prune_config = {
+    .futility_margin = 100, .futility_capture = 200, .futility_depth = 1,
+    .razor_margin = 0, .razor_depth = 3,
+    .probcut_margin = 0, .probcut_depth = 5, .probcut_reduction = 4,
+};
+
+// Noeuds passés sous chaque coup racine à l'itération précédente (tri de la racine)
+static uint64_t root_nodes[16][4];
+static bool root_nodes_valid = false;
+
+// Cache d'évaluation : petite table à accès direct (tient dans le cache L2),
+// indépendante de la TT. La clé est le hash Zobrist du plateau + joueur + scores,
+// qui ne dépend pas de la profondeur ni de la fenêtre alpha/beta.
+#define EVAL_CACHE_SIZE (1 << 13)
+
+typedef struct {
+    uint64_t key;
+    int eval;
+} EvalCacheEntry;
+
+static EvalCacheEntry eval_cache[EVAL_CACHE_SIZE];
+static struct {
+    uint64_t hits;
+    uint64_t misses;
+} eval_cache_stats;
+
 // Structure pour garder des stats (juste pour nous, pour débugger)
 static struct {
     uint64_t nodes_searched;
@@ -35,22 +99,63 @@ static struct {
     uint64_t tt_cutoffs;
     uint64_t null_cutoffs;
     uint64_t lmr_reductions;
+    uint64_t futility_prunes;
+    uint64_t razor_cutoffs;
+    uint64_t probcut_cutoffs;
+    uint64_t beta_cutoffs[MAX_DEPTH + 1];        // Par profondeur restante
+    uint64_t first_move_cutoffs[MAX_DEPTH + 1];  // Dont coupures au premier coup
     int max_depth_reached;
     int current_depth;
 } stats;
 
+// Solveur de fin de partie (cumulé sur la partie)
+static struct {
+    uint64_t calls;
+    uint64_t proven;
+    uint64_t nodes;
+} solver_stats;
+
 
 // FONCTIONS UTILITAIRES
 
 
-// Remet toutes les variables à zéro avant de commencer une nouvelle recherche
-static void reset_search(void) {
-    memset(killer_moves, 0, sizeof(killer_moves));
-    memset(history_scores, 0, sizeof(history_scores));
+// Prépare une nouvelle recherche sans jeter ce qu'on a appris au coup précédent :
+// l'historique est vieilli (divisé par 2). Les killers sont décalés de 2 plies si la racine
+// a avancé de deux demi-coups (notre coup + celui de l'adversaire), gardés si c'est la même
+// racine, et effacés sinon (même moteur pour les deux camps : bench, self-play, démon)
+static void reset_search(const GameState* game) {
+    int advance = game->total_moves - last_root_moves;
+    if (last_root_moves < 0 || game->current != last_root_player || (advance != 0 && advance != 2)) {
+        memset(killer_moves, 0, sizeof(killer_moves));
+    } else if (advance == 2) {
+        for (int ply = 0; ply < MAX_DEPTH; ply++) {
+            for (int k = 0; k < MAX_KILLER_MOVES; k++) {
+                killer_moves[ply][k] = (ply + 2 < MAX_DEPTH) ? killer_moves[ply + 2][k] : (AIMove){0, RED};
+            }
+        }
+    }
+    last_root_moves = game->total_moves;
+    last_root_player = game->current;
+    for (int h = 0; h < 16; h++)
+        for (int c = 0; c < 4; c++)
+            history_scores[h][c] /= 2;
+    for (int m = 0; m < MOVE_INDEXES; m++)
+        for (int b = 0; b < CAPTURE_BUCKETS; b++)
+            capture_history[m][b] /= 2;
+    
+    memset(root_nodes, 0, sizeof(root_nodes));
+    root_nodes_valid = false;
     memset(&stats, 0, sizeof(stats));
     stop_search = false;
 }
 
+static bool root_excluded(AIMove move) {
+    for (int i = 0; i < root_n_exclude; i++) {
+        if (root_exclude[i].hole == move.hole && root_exclude[i].color == move.color) return true;
+    }
+    return false;
+}
+
 // Ajoute un killer move (= coup qui a causé une coupure beta)
 static inline void add_killer(AIMove move, int ply) {
     if (ply >= MAX_DEPTH) return;
@@ -83,11 +188,38 @@ static inline bool is_killer(AIMove move, int ply) {
            (killer_moves[ply][1].hole == move.hole && killer_moves[ply][1].color == move.color);
 }
 
+static inline int move_index(AIMove move) {
+    return (move.hole - 1) * 4 + move.color;
+}
+
+// Bonus ou malus borné : plus l'entrée est grande, moins elle bouge
+static inline void update_bounded(int* entry, int bonus) {
+    *entry += bonus - *entry * abs(bonus) / ORDER_HISTORY_MAX;
+}
+
+static inline int capture_bucket(int gain) {
+    return gain < CAPTURE_BUCKETS ? gain : CAPTURE_BUCKETS - 1;
+}
+
+// Coupure beta : une capture qui coupe est récompensée, les captures cherchées avant
+// le coup qui a coupé sont pénalisées
+static void update_capture_history(AIMove move, int gain, int depth, const AIMove* captures,
+                                   const int* capture_gains, int n_captures) {
+    int bonus = (depth < 32) ? depth * depth : 1024;
+    if (gain > 0) update_bounded(&capture_history[move_index(move)][capture_bucket(gain)], bonus);
+    for (int i = 0; i < n_captures; i++) {
+        update_bounded(&capture_history[move_index(captures[i])][capture_bucket(capture_gains[i])], -bonus);
+    }
+}
+
 // Vérifie si on a dépassé le temps imparti 
 // On le fait tous les 4096 noeuds pour ne pas ralentir l'algo avec des appels système
+// (on en profite pour regarder la limite de noeuds et la commande "stop")
 static inline bool check_timeout(void) {
     if ((stats.nodes_searched & 4095) == 0) {
-        if (clock() > search_end_time) {
+        if ((use_time_limit && clock() > search_end_time) ||
+            (external_stop && *external_stop) ||
+            (node_limit && stats.nodes_searched >= node_limit)) {
             stop_search = true;
         }
     }
@@ -95,11 +227,50 @@ static inline bool check_timeout(void) {
 }
 
 
+// NOYAUX PAR CAMP
+// side = 1 ou 2 : variantes spécialisées (camp au trait connu à la compilation),
+// side = 0 : versions génériques, gardées pour la comparaison du bench.
+// negamax est compilé en trois exemplaires et alterne entre _p1 et _p2.
+
+static bool side_specialized = true;
+
+static FORCE_INLINE int side_generate(const Board* board, int side, int player, AIMove* moves) {
+    if (side == 1) return generate_legal_moves_p1(board, moves);
+    if (side == 2) return generate_legal_moves_p2(board, moves);
+    return generate_legal_moves(board, player, moves);
+}
+
+static FORCE_INLINE int side_predict(const Board* board, int hole, Color color, int side, int player) {
+    if (side == 1) return quick_predict_score_p1(board, hole, color);
+    if (side == 2) return quick_predict_score_p2(board, hole, color);
+    return quick_predict_score(board, hole, color, player);
+}
+
+static FORCE_INLINE int side_exchange(const Board* board, int hole, Color color, int side, int player,
+                                      int* gain) {
+    if (side == 1) return static_exchange_p1(board, hole, color, gain);
+    if (side == 2) return static_exchange_p2(board, hole, color, gain);
+    return static_exchange(board, hole, color, player, gain);
+}
+
+static FORCE_INLINE int side_recapture(const Board* after, int side, int player) {
+    if (side == 1) return best_recapture_p2(after);
+    if (side == 2) return best_recapture_p1(after);
+    return best_recapture(after, (player == 1) ? 2 : 1);
+}
+
+static FORCE_INLINE bool side_play_sown(GameState* game, const SownMove* move, int side) {
+    if (side == 1) return game_play_sown_p1(game, move);
+    if (side == 2) return game_play_sown_p2(game, move);
+    return game_play_sown(game, move);
+}
+
+
 // ANALYSE DU PLATEAU (aide à l'évaluation)
 
 
 // Compte simplement les graines chez nous et chez l'adversaire
-static void count_seeds(const Board* board, int player, int* my_seeds, int* opp_seeds) {
+static FORCE_INLINE void count_seeds(const Board* board, int player, int* my_seeds, int* opp_seeds) {
     *my_seeds = 0;
     *opp_seeds = 0;
     
@@ -116,7 +287,7 @@ static void count_seeds(const Board* board, int player, int* my_seeds, int* opp_
 }
 
 // Compte les trous vulnérables (1 ou 2 graines) qu'on peut se faire manger :(
-static int count_vulnerable_holes(const Board* board, int player) {
+static FORCE_INLINE int count_vulnerable_holes(const Board* board, int player) {
     int count = 0;
     int start = (player == 1) ? 0 : 1;
     
@@ -130,7 +301,7 @@ static int count_vulnerable_holes(const Board* board, int player) {
 }
 
 // Compte les trous avec beaucoup de graines (=> pour la stratégie long terme)
-static int count_loaded_holes(const Board* board, int player) {
+static FORCE_INLINE int count_loaded_holes(const Board* board, int player) {
     int count = 0;
     int start = (player == 1) ? 0 : 1;
     
@@ -143,28 +314,60 @@ static int count_loaded_holes(const Board* board, int player) {
     return count;
 }
 
-// On essaie de voir si on peut capturer des graines au prochain coup
-static int evaluate_capture_potential(const Board* board, int player) {
-    int potential = 0;
-    AIMove moves[64];
-    int n = generate_legal_moves(board, player, moves);
+// Dernière graine d'un coup de "seeds" graines depuis le trou start :
+// les rouges parcourent les 15 autres trous, les bleues les 8 trous adverses
+static inline int landing_any(int start, int seeds) {
+    return (start + 1 + (seeds - 1) % 15) & 15;
+}
+
+static inline int landing_opponent(int start, int seeds) {
+    return (start + 1 + 2 * ((seeds - 1) & 7)) & 15;
+}
+
+// Gain estimé si la dernière graine tombe sur ce trou (même règle que quick_predict_score)
+static inline int landing_gain(const Board* board, int hole) {
+    int f = board->holes[hole].red + board->holes[hole].blue + board->holes[hole].transparent + 1;
+    return (f == 2 || f == 3) ? f : 0;
+}
+
+// Mobilité et potentiel de capture d'un camp, sans générer la liste des coups.
+// Mêmes valeurs que generate_legal_moves (nombre de coups) et que le meilleur
+// quick_predict_score parmi les 10 premiers coups générés.
+static FORCE_INLINE void side_mobility_potential(const Board* board, int player, int* mobility, int* potential) {
+    int n = 0, best = 0;
     
-    // On regarde juste les 10 premiers coups pour pas perdre trop de temps
-    for (int i = 0; i < n && i < 10; i++) { 
-        int gain = quick_predict_score(board, moves[i].hole - 1, moves[i].color, player);
-        if (gain > potential) {
-            potential = gain;
+    for (int h = player - 1; h < 16; h += 2) {
+        int r = board->holes[h].red, b = board->holes[h].blue, t = board->holes[h].transparent;
+        if (r > 0) {
+            if (n < 10) { int g = landing_gain(board, landing_any(h, r)); if (g > best) best = g; }
+            n++;
+        }
+        if (b > 0) {
+            if (n < 10) { int g = landing_gain(board, landing_opponent(h, b)); if (g > best) best = g; }
+            n++;
+        }
+        if (t > 0) {
+            if (n < 10) { int g = landing_gain(board, landing_any(h, t + r)); if (g > best) best = g; }
+            n++;
+            if (n < 10) { int g = landing_gain(board, landing_opponent(h, t + b)); if (g > best) best = g; }
+            n++;
         }
     }
-    return potential;
+    *mobility = n;
+    *potential = best;
 }
 
-
 // FONCTION D'ÉVALUATION
 // basée sur plusieurs critères stratégiques : 
 
 // on donne une note au plateau
-static int evaluate(const Board* board, int player, const int scores[3], int ply) {
+// side != 0 : player == side est une constante, les tests de camp disparaissent
+// alpha/beta : fenêtre de la recherche (utilisée par l'évaluation paresseuse, LAZY_EVAL) ;
+// *exact passe à false si la note rendue n'est qu'une borne hors de la fenêtre
+static FORCE_INLINE int evaluate_side(const Board* board, int side, int player, const int scores[3], int ply,
+                                      int alpha, int beta, bool* exact) {
+    if (side) player = side;
+    *exact = true;
     int opponent = (player == 1) ? 2 : 1;
     
     // Gestion des fins de partie (victoire/défaite immédiate)
@@ -184,43 +387,47 @@ static int evaluate(const Board* board, int player, const int scores[3], int ply
         return 0;
     }
     
+    const int* w = eval_params;
     int eval = 0;
     bool early_game = (total_captured < 20);  
     
+    // Les termes sont calculés du moins cher au plus cher : différence de score et
+    // comptes de graines d'abord, puis un seul passage par camp pour la mobilité
+    // et le potentiel de capture (plus d'appel à generate_legal_moves)
+    
     // Bonus pour encourager l'IA à jouer
-    eval += early_game ? 30 : 15;
+    eval += early_game ? w[EP_TEMPO_EARLY] : w[EP_TEMPO_LATE];
     
     // 1. La différence de score (=> critère principal)
     int score_diff = scores[player] - scores[opponent];
-    if (early_game) eval += score_diff * 100;
-    else if (total_captured < 60) eval += score_diff * 150;
-    else eval += score_diff * 200; // En fin de partie, chaque point compte double 
+    if (early_game) eval += score_diff * w[EP_SCORE_EARLY];
+    else if (total_captured < 60) eval += score_diff * w[EP_SCORE_MID];
+    else eval += score_diff * w[EP_SCORE_LATE]; // En fin de partie, chaque point compte double 
     
     // 2. On essaie de garder des graines chez nous (= défense)
-    eval += (my_seeds - opp_seeds) * 10;
+    eval += (my_seeds - opp_seeds) * w[EP_SEEDS];
+    
+    // Bonus/Malus pour les seuils de score importants
+    if (scores[player] >= 40) eval += (scores[player] - 39) * w[EP_THRESHOLD];
+    if (scores[opponent] >= 40) eval -= (scores[opponent] - 39) * w[EP_THRESHOLD];
     
-    // 3. Mobilité (avoir plus de choix de coups que l'adversaire)
-    AIMove my_moves[64], opp_moves[64];
-    int my_mobility = generate_legal_moves(board, player, my_moves);
-    int opp_mobility = generate_legal_moves(board, opponent, opp_moves);
-    eval += (my_mobility - opp_mobility) * (early_game ? 12 : 8);
+    // On évite d'avoir trop peu de graines quand l'adversaire en a beaucoup (famine ?)
+    if (my_seeds < 5 && opp_seeds > 10) eval -= w[EP_FAMINE_SELF];
+    if (opp_seeds < 5 && my_seeds > 10) eval += w[EP_FAMINE_OPP];
     
-    // 4. Pénalité pour les trous vulnérables
+    if (early_game && my_seeds > opp_seeds + 3) eval += w[EP_SEED_LEAD_EARLY];
+    
+    // 3. Pénalité pour les trous vulnérables
     int my_vulnerable = count_vulnerable_holes(board, player);
     int opp_vulnerable = count_vulnerable_holes(board, opponent);
-    eval += (opp_vulnerable - my_vulnerable) * 15;
+    eval += (opp_vulnerable - my_vulnerable) * w[EP_VULNERABLE];
     
-    // 5. Bonus pour les gros trous (stratégie long terme)
+    // 4. Bonus pour les gros trous (stratégie long terme)
     int my_loaded = count_loaded_holes(board, player);
     int opp_loaded = count_loaded_holes(board, opponent);
-    eval += (my_loaded - opp_loaded) * 10;
-    
-    // 6. Potentiel de capture immédiat
-    int my_capture_potential = evaluate_capture_potential(board, player);
-    int opp_capture_potential = evaluate_capture_potential(board, opponent);
-    eval += (my_capture_potential - opp_capture_potential) * (early_game ? 25 : 15);
+    eval += (my_loaded - opp_loaded) * w[EP_LOADED];
     
-    // 7. En début de partie, on essaie d'avoir des trous actifs (2 à 10 graines)
+    // 5. En début de partie, on essaie d'avoir des trous actifs (2 à 10 graines)
     if (early_game) {
         int my_active_holes = 0;
         int start = (player == 1) ? 0 : 1;
@@ -228,39 +435,125 @@ static int evaluate(const Board* board, int player, const int scores[3], int ply
             int t = board->holes[i].red + board->holes[i].blue + board->holes[i].transparent;
             if (t >= 2 && t <= 10) my_active_holes++;
         }
-        eval += my_active_holes * 5;
+        eval += my_active_holes * w[EP_ACTIVE_EARLY];
     }
     
-    // 8. Bonus/Malus pour les seuils de score importants
-    if (scores[player] >= 40) eval += (scores[player] - 39) * 100;
-    if (scores[opponent] >= 40) eval -= (scores[opponent] - 39) * 100;
+#ifdef LAZY_EVAL
+    // Les deux derniers termes valent au plus 32 coups d'écart de mobilité et 3 graines
+    // de potentiel : si même ce maximum ne ramène pas la note dans la fenêtre, on rend la borne
+    int margin = early_game ? 32 * abs(w[EP_MOBILITY_EARLY]) + 3 * abs(w[EP_POTENTIAL_EARLY])
+                            : 32 * abs(w[EP_MOBILITY_LATE]) + 3 * abs(w[EP_POTENTIAL_LATE]);
+    if (eval + margin <= alpha) {
+        *exact = false;
+        return eval + margin;
+    }
+    if (eval - margin >= beta) {
+        *exact = false;
+        return eval - margin;
+    }
+#else
+    (void)alpha;
+    (void)beta;
+#endif
     
-    // On évite d'avoir trop peu de graines quand l'adversaire en a beaucoup (famine ?)
-    if (my_seeds < 5 && opp_seeds > 10) eval -= 400;
-    if (opp_seeds < 5 && my_seeds > 10) eval += 300;
+    // 6. Mobilité (avoir plus de choix de coups que l'adversaire)
+    // 7. Potentiel de capture immédiat
+    int my_mobility, opp_mobility, my_capture_potential, opp_capture_potential;
+    side_mobility_potential(board, player, &my_mobility, &my_capture_potential);
+    side_mobility_potential(board, opponent, &opp_mobility, &opp_capture_potential);
+    eval += (my_mobility - opp_mobility) * (early_game ? w[EP_MOBILITY_EARLY] : w[EP_MOBILITY_LATE]);
+    eval += (my_capture_potential - opp_capture_potential) *
+            (early_game ? w[EP_POTENTIAL_EARLY] : w[EP_POTENTIAL_LATE]);
     
-    if (early_game && my_seeds > opp_seeds + 3) eval += 50;
+    return eval;
+}
+
+static int evaluate(const Board* board, int player, const int scores[3], int ply) {
+    bool exact;
+    return evaluate_side(board, 0, player, scores, ply, -INFINITY_SCORE, INFINITY_SCORE, &exact);
+}
+
+static int evaluate_window(const Board* board, int player, const int scores[3], int ply,
+                           int alpha, int beta, bool* exact) {
+    return evaluate_side(board, 0, player, scores, ply, alpha, beta, exact);
+}
+
+static int evaluate_p1(const Board* board, const int scores[3], int ply, int alpha, int beta, bool* exact) {
+    return evaluate_side(board, 1, 1, scores, ply, alpha, beta, exact);
+}
+
+static int evaluate_p2(const Board* board, const int scores[3], int ply, int alpha, int beta, bool* exact) {
+    return evaluate_side(board, 2, 2, scores, ply, alpha, beta, exact);
+}
+
+
+// evaluate() avec le cache. Les scores de victoire/défaite dépendent du ply,
+// on ne les met donc pas en cache (ils sont rares et rapides à recalculer)
+static FORCE_INLINE int evaluate_cached(uint64_t hash, const Board* board, int side, int player,
+                                        const int scores[3], int ply, int alpha, int beta) {
+    EvalCacheEntry* entry = &eval_cache[hash & (EVAL_CACHE_SIZE - 1)];
+    if (entry->key == hash) {
+        eval_cache_stats.hits++;
+        return entry->eval;
+    }
+    eval_cache_stats.misses++;
     
+    bool exact;
+    int eval = (side == 1)   ? evaluate_p1(board, scores, ply, alpha, beta, &exact)
+               : (side == 2) ? evaluate_p2(board, scores, ply, alpha, beta, &exact)
+                             : evaluate_window(board, player, scores, ply, alpha, beta, &exact);
+    // Une borne (évaluation paresseuse) ne va pas dans le cache
+    if (exact && eval > -WIN_SCORE + 1000 && eval < WIN_SCORE - 1000) {
+        entry->key = hash;
+        entry->eval = eval;
+    }
     return eval;
 }
 
+// Score d'une position terminale (49 graines, moins de 10 graines, limite des 400 coups) :
+// celui qui a le plus de graines gagne
+static int terminal_score(const GameState* game, int ply) {
+    int player = game->current;
+    int opponent = (player == 1) ? 2 : 1;
+    if (game->score[player] > game->score[opponent]) return WIN_SCORE - ply;
+    if (game->score[opponent] > game->score[player]) return -WIN_SCORE + ply;
+    return 0;
+}
+
 
 // TRI DES COUPS 
 
 
 // On donne une note à chaque coup pour les trier
 // Le but = examiner les meilleurs coups en premier pour l'élagage alpha-beta
-static int score_move(AIMove move, AIMove tt_move, int ply, const Board* board, int player) {
+// sown : le coup déjà semé par l'expansion groupée (NULL : gain estimé sur le plateau)
+// exchange : calculer la reprise adverse (inutile s'il n'y a qu'une capture à classer)
+static FORCE_INLINE int score_move(AIMove move, AIMove tt_move, int ply, const Board* board, int side, int player,
+                                   const SownMove* sown, bool exchange) {
 
     // Si c'est le coup qui vient de la Table de Transposition, c'est le meilleur
     if (tt_move.hole != 0 && move.hole == tt_move.hole && move.color == tt_move.color) {
         return 10000000;
     }
     
-    // Si le coup permet de capturer, on lui donne un gros score
-    int capture = quick_predict_score(board, move.hole - 1, move.color, player);
+    // Captures triées par échange statique : rafle exacte, moins ce que l'adversaire reprend
+    // (gain + net : une capture perdante reste devant les killers, la rétrograder coûte des noeuds)
+    int capture = sown ? sown->gain : side_predict(board, move.hole - 1, move.color, side, player);
     if (capture > 0) {
-        return 5000000 + capture * 10000;
+        int gain, net;
+        if (sown && !exchange) {
+            gain = net = sown->gain;
+        } else if (sown) {
+            Board after = *board;
+            sow_apply(&after, sown);
+            gain = sown->gain;
+            net = gain - side_recapture(&after, side, player);
+        } else {
+            net = side_exchange(board, move.hole - 1, move.color, side, player, &gain);
+        }
+        // À échange égal : historique des captures, puis rafle
+        return 5000000 + (gain + net) * 10000 + gain * 200 +
+               capture_history[move_index(move)][capture_bucket(gain)] / 256;
     }
     
     // Si c'est un "killer move"
@@ -277,55 +570,135 @@ static int score_move(AIMove move, AIMove tt_move, int ply, const Board* board,
     return 0;
 }
 
+// À la racine, les coups calmes sont triés selon le nombre de noeuds de l'itération
+// précédente plutôt que l'historique : un coup qui a demandé beaucoup de travail
+// est souvent le meilleur ou proche (le coup TT et les captures restent devant)
+static int score_root_move(AIMove move, AIMove tt_move, const Board* board, int player, const SownMove* sown) {
+    int score = score_move(move, tt_move, 0, board, 0, player, sown, true);
+    if (score >= 4000000) return score;
+    uint64_t nodes = root_nodes[move.hole - 1][move.color];
+    return (nodes < 3999999) ? (int)nodes : 3999999;
+}
+
 // Fonction de tri (insertion sort, suffisant ici)
-static void sort_moves(AIMove* moves, int n, AIMove tt_move, int ply, const Board* board, int player) {
+// Avec l'expansion groupée (sown non NULL), order[i] donne l'indice dans sown du i-ème coup trié.
+// depth : profondeur restante du noeud (l'échange statique n'est calculé qu'à partir de SEE_MIN_DEPTH)
+static FORCE_INLINE void sort_moves(AIMove* moves, int n, AIMove tt_move, int ply, const Board* board,
+                                    int side, int player, const SownMove* sown, int* order, int depth) {
     int scores[64];
+    // L'échange statique ne sert qu'à classer les captures entre elles : avec une seule
+    // capture (hors coup TT), elle passe devant les coups calmes sans semer de reprise.
+    // Près des feuilles, la reprise semée coûte plus que les noeuds qu'elle fait gagner :
+    // les captures y sont classées par leur rafle seule
+    int captures = 0;
+    for (int i = 0; sown && i < n && captures < 2; i++) {
+        bool is_tt = moves[i].hole == tt_move.hole && moves[i].color == tt_move.color;
+        captures += (sown[i].gain > 0 && !is_tt);
+    }
+    bool exchange = !sown || (captures > 1 && depth >= SEE_MIN_DEPTH);
     for (int i = 0; i < n; i++) {
-        scores[i] = score_move(moves[i], tt_move, ply, board, player);
+        const SownMove* s = sown ? &sown[i] : NULL;
+        if (ply == 0 && root_nodes_valid) scores[i] = score_root_move(moves[i], tt_move, board, player, s);
+        else scores[i] = score_move(moves[i], tt_move, ply, board, side, player, s, exchange);
+        if (order) order[i] = i;
     }
     
     for (int i = 1; i < n; i++) {
         int key_score = scores[i];
         AIMove key_move = moves[i];
+        int key_index = order ? order[i] : 0;
         int j = i - 1;
         while (j >= 0 && scores[j] < key_score) {
             scores[j + 1] = scores[j];
             moves[j + 1] = moves[j];
+            if (order) order[j + 1] = order[j];
             j--;
         }
         scores[j + 1] = key_score;
         moves[j + 1] = key_move;
+        if (order) order[j + 1] = key_index;
     }
 }
 
 // ALGORITHME NEGAMAX
 
 
-static int negamax(GameState* game, int depth, int alpha, int beta, int ply, 
-                   AIMove* best_move, bool allow_null) {
+static int negamax_generic(GameState* game, int depth, int alpha, int beta, int ply,
+                           AIMove* best_move, bool allow_null);
+static int negamax_p1(GameState* game, int depth, int alpha, int beta, int ply,
+                      AIMove* best_move, bool allow_null);
+static int negamax_p2(GameState* game, int depth, int alpha, int beta, int ply,
+                      AIMove* best_move, bool allow_null);
+
+// Noeud fils : l'autre camp est au trait
+#define NEGAMAX_CHILD(side, ...)                                                  \
+    ((side) == 1 ? negamax_p2(__VA_ARGS__)                                       \
+                 : (side) == 2 ? negamax_p1(__VA_ARGS__) : negamax_generic(__VA_ARGS__))
+
+// Même noeud, autre profondeur (vérification du razoring)
+#define NEGAMAX_SELF(side, ...)                                                   \
+    ((side) == 1 ? negamax_p1(__VA_ARGS__)                                       \
+                 : (side) == 2 ? negamax_p2(__VA_ARGS__) : negamax_generic(__VA_ARGS__))
+
+// Le coup (de gain donné) termine-t-il la partie ? Mêmes conditions que game_over()
+static FORCE_INLINE bool ends_game(const GameState* game, int player, int gain, int seeds_in_play) {
+    int score = game->score[player] + gain, opp_score = game->score[3 - player];
+    return score >= 49 || seeds_in_play - gain < 10 || (score == 48 && opp_score == 48) ||
+           game->total_moves + 1 >= 400;
+}
+
+static FORCE_INLINE int negamax_side(GameState* game, int depth, int alpha, int beta, int ply,
+                                     AIMove* best_move, bool allow_null, int side) {
     
     if (check_timeout()) return 0;
+    int player = side ? side : game->current;
     
     stats.nodes_searched++;
     if (ply > stats.max_depth_reached) stats.max_depth_reached = ply;
+    TRACE_NODE(ply, depth, alpha, beta);
     
     // 1. On regarde dans la Table de Transposition (TT)
-    uint64_t hash = zobrist_hash(&game->board, game->current, game->score);
+#ifdef TT_SYMMETRY
+    // Clé canonique : la position et ses rotations (joueurs échangés si impaire) partagent l'entrée
+    int rotation;
+    uint64_t hash = zobrist_hash_canonical(&game->board, player, game->score, &rotation);
+#else
+    int rotation = 0;
+    uint64_t hash = zobrist_hash(&game->board, player, game->score);
+#endif
     TTEntry tt_entry;
     AIMove tt_move = {0, RED};
     
-    if (tt_probe(hash, depth, alpha, beta, &tt_entry)) {
+    bool tt_hit;
+    bool partial_root = (ply == 0 && root_n_exclude > 0);
+    PROF(PROF_TT_PROBE, tt_hit = tt_probe(hash, depth, alpha, beta, &tt_entry));
+    if (partial_root) tt_hit = false;
+    tt_entry.best_move = tt_move_from_canonical(tt_entry.best_move, rotation);
+    if (tt_hit) {
         stats.tt_hits++;
         if (best_move && tt_entry.best_move.hole != 0) *best_move = tt_entry.best_move;
         stats.tt_cutoffs++;
+        TRACE_SET(tt, TRACE_TT_CUTOFF);
+        TRACE_END(TRACE_CUT_TT, tt_entry.score);
         return tt_entry.score;
     }
     if (tt_entry.best_move.hole != 0) tt_move = tt_entry.best_move;
+    TRACE_SET(tt, tt_move.hole ? TRACE_TT_MOVE : TRACE_TT_MISS);
     
     // Conditions d'arrêt (fin de partie ou profondeur max atteinte)
-    if (game_over(game) || depth <= 0) {
-        int eval = evaluate(&game->board, game->current, game->score, ply);
-        tt_store(hash, depth, eval, EXACT, (AIMove){0, RED});
+    if (game_over(game)) {
+        int eval = terminal_score(game, ply);
+        PROF(PROF_TT_STORE, tt_store(hash, depth, eval, EXACT, (AIMove){0, RED}));
+        TRACE_END(TRACE_CUT_TERMINAL, eval);
+        return eval;
+    }
+    if (depth <= 0) {
+        int eval;
+        // Pas de tt_store ici : les feuilles vont dans le cache d'évaluation,
+        // la TT garde sa place pour les noeuds internes
+        PROF(PROF_EVALUATE, eval = evaluate_cached(hash, &game->board, side, player, game->score, ply,
+                                                   alpha, beta));
+        TRACE_END(TRACE_CUT_LEAF, eval);
         return eval;
     }
     
@@ -333,85 +706,181 @@ static int negamax(GameState* game, int depth, int alpha, int beta, int ply,
     // On essaie de "ne rien faire". Si on est toujours gagnant, la position est très forte.
     if (allow_null && depth >= 3 && ply > 0) {
         int my_seeds = 0, opp_seeds = 0;
-        count_seeds(&game->board, game->current, &my_seeds, &opp_seeds);
+        count_seeds(&game->board, player, &my_seeds, &opp_seeds);
         
         // On ne le fait pas si on a peu de graines = risqué
         if (my_seeds > 5) {
             GameState null_game = *game;
-            null_game.current = (game->current == 1) ? 2 : 1;
+            null_game.current = (player == 1) ? 2 : 1;
             
             // On réduit la profondeur pour cette recherche
             int R = 2 + depth / 4;
             AIMove dummy;
-            int null_score = -negamax(&null_game, depth - 1 - R, -beta, -beta + 1, 
-                                      ply + 1, &dummy, false);
+            int null_score = -NEGAMAX_CHILD(side, &null_game, depth - 1 - R, -beta, -beta + 1,
+                                            ply + 1, &dummy, false);
             
             if (stop_search) return 0;
             if (null_score >= beta) {
                 stats.null_cutoffs++;
+                TRACE_SET(null_move, 2);
+                TRACE_END(TRACE_CUT_NULL, beta);
                 return beta; // Coupure Beta
             }
+            TRACE_SET(null_move, 1);
         }
     }
     
+    // Élagage sélectif : hors variante principale (fenêtre nulle) et loin des scores de victoire,
+    // sur l'évaluation statique du noeud (déjà dans le cache d'évaluation le plus souvent)
+    bool prunable = (beta - alpha == 1) && ply > 0 && !partial_root &&
+                    alpha > -WIN_SCORE + 1000 && beta < WIN_SCORE - 1000;
+    int static_eval = 0;
+    bool futility = prunable && prune_config.futility_margin > 0 && depth <= prune_config.futility_depth;
+    bool razoring = prunable && prune_config.razor_margin > 0 && depth >= 2 && depth <= prune_config.razor_depth;
+    bool probcut = prunable && prune_config.probcut_margin > 0 && depth >= prune_config.probcut_depth;
+    if (futility || razoring || probcut) {
+        static_eval = evaluate_cached(hash, &game->board, side, player, game->score, ply,
+                                      -INFINITY_SCORE, INFINITY_SCORE);
+    }
+
+    // Razoring : très en dessous d'alpha, une recherche à profondeur 1 doit trouver de quoi remonter
+    if (razoring && static_eval + prune_config.razor_margin * depth <= alpha) {
+        AIMove dummy;
+        int score = NEGAMAX_SELF(side, game, 1, alpha, beta, ply, &dummy, false);
+        if (stop_search) return 0;
+        if (score <= alpha) {
+            stats.razor_cutoffs++;
+            TRACE_END(TRACE_CUT_PRUNED, score);
+            return score;
+        }
+    }
+
     // Génération des coups
     AIMove moves[64];
-    int n = generate_legal_moves(&game->board, game->current, moves);
+    int n;
+    PROF(PROF_MOVEGEN, n = side_generate(&game->board, side, player, moves));
+    
+    TRACE_SET(n_moves, n);
     
     // Pas de coups possibles => on évalue
-    if (n == 0) return evaluate(&game->board, game->current, game->score, ply);
+    if (n == 0) {
+        int eval = evaluate_cached(hash, &game->board, side, player, game->score, ply,
+                                   -INFINITY_SCORE, INFINITY_SCORE);
+        TRACE_END(TRACE_CUT_LEAF, eval);
+        return eval;
+    }
     
+    // Tous les coups analysés en une passe (gain exact, trou d'arrivée) : le tri, la LMR et
+    // la descente les réutilisent ; le plateau d'un fils n'est écrit que s'il est cherché
+    SownMove sown[32]; // 8 trous x 4 couleurs au plus
+    int order[64];
+    PROF(PROF_APPLY, expand_moves(&game->board, moves, n, sown));
+
     // Tri des coups pour optimiser l'élagage
-    sort_moves(moves, n, tt_move, ply, &game->board, game->current);
+    PROF(PROF_SORT, sort_moves(moves, n, tt_move, ply, &game->board, side, player, sown, order, depth));
     
+    // ProbCut : si une capture tient beta + marge à profondeur réduite, la recherche complète
+    // couperait très probablement aussi
+    if (probcut && static_eval >= beta) {
+        int probcut_beta = beta + prune_config.probcut_margin;
+        int probcut_depth = depth - 1 - prune_config.probcut_reduction;
+        for (int i = 0; i < n; i++) {
+            const SownMove* m = &sown[order[i]];
+            if (m->gain == 0) continue;
+            GameState child = *game;
+            if (!side_play_sown(&child, m, side)) continue;
+            AIMove dummy;
+            int score = -NEGAMAX_CHILD(side, &child, probcut_depth, -probcut_beta, -probcut_beta + 1,
+                                       ply + 1, &dummy, true);
+            if (stop_search) return 0;
+            if (score >= probcut_beta) {
+                stats.probcut_cutoffs++;
+                PROF(PROF_TT_STORE, tt_store(hash, probcut_depth + 1, score, LOWER_BOUND,
+                                             tt_move_to_canonical(moves[i], rotation)));
+                TRACE_END(TRACE_CUT_PRUNED, score);
+                return score;
+            }
+        }
+    }
+
     int original_alpha = alpha;
     AIMove local_best = moves[0];
     int best_score = -INFINITY_SCORE;
+    AIMove captures[64];
+    int capture_gains[64];
+    int n_captures = 0;
     
+    // Graines en jeu, pour reconnaître les coups qui finissent la partie
+    int seeds_in_play = futility ? board_total_seeds(&game->board) : 0;
+
     // Boucle sur les coups
     for (int i = 0; i < n; i++) {
+        if (partial_root && root_excluded(moves[i])) continue;
+
+        // Futility : même avec sa capture et la marge, ce coup ne ramènerait pas la note à alpha.
+        // Jamais pour un coup qui finit la partie (49 graines, moins de 10 en jeu, 48-48, 400 coups) :
+        // l'évaluation statique n'en dit rien
+        if (futility && i > 0 && !is_killer(moves[i], ply) &&
+            !ends_game(game, player, sown[order[i]].gain, seeds_in_play)) {
+            int futility_value = static_eval + prune_config.futility_margin * depth +
+                                 sown[order[i]].gain * prune_config.futility_capture;
+            if (futility_value <= alpha) {
+                stats.futility_prunes++;
+                if (futility_value > best_score) best_score = futility_value;
+                continue;
+            }
+        }
+
         GameState child = *game;
-        if (!apply_move(&child, moves[i])) continue;
+        bool applied;
+        PROF(PROF_APPLY, applied = side_play_sown(&child, &sown[order[i]], side));
+        if (!applied) continue;
         
         int score;
         AIMove dummy;
+        uint64_t nodes_before = stats.nodes_searched;
         
 
         // Les coups tardifs dans la liste sont probablement mauvais, on les cherche moins profond
         bool do_full_search = true;
         
         if (i >= 3 && depth >= 3 && !is_killer(moves[i], ply)) {
-            int capture = quick_predict_score(&game->board, moves[i].hole - 1, 
-                                              moves[i].color, game->current);
             // On ne réduit pas si c'est une capture
-            if (capture == 0) {
+            if (sown[order[i]].gain == 0) {
                 int R = 1 + i / 6;
                 stats.lmr_reductions++;
-                score = -negamax(&child, depth - 1 - R, -alpha - 1, -alpha, 
-                                 ply + 1, &dummy, true);
+                TRACE_INC(lmr_searches);
+                TRACE_MAX(reduction, R);
+                score = -NEGAMAX_CHILD(side, &child, depth - 1 - R, -alpha - 1, -alpha,
+                                       ply + 1, &dummy, true);
                 if (stop_search) return 0;
                 // Si le score est intéressant, on devra refaire une recherche complète
                 do_full_search = (score > alpha);
+                if (do_full_search) TRACE_INC(lmr_researches);
             }
         }
         
         if (do_full_search) {
             // Principal Variation Search 
             if (i == 0) {
-                score = -negamax(&child, depth - 1, -beta, -alpha, ply + 1, &dummy, true);
+                score = -NEGAMAX_CHILD(side, &child, depth - 1, -beta, -alpha, ply + 1, &dummy, true);
             } else {
                 // Recherche avec fenêtre nulle
-                score = -negamax(&child, depth - 1, -alpha - 1, -alpha, ply + 1, &dummy, true);
+                TRACE_INC(zw_searches);
+                score = -NEGAMAX_CHILD(side, &child, depth - 1, -alpha - 1, -alpha, ply + 1, &dummy, true);
                 if (stop_search) return 0;
                 if (score > alpha && score < beta) {
                     // Si ça échoue, recherche complète
-                    score = -negamax(&child, depth - 1, -beta, -alpha, ply + 1, &dummy, true);
+                    TRACE_INC(pvs_researches);
+                    score = -NEGAMAX_CHILD(side, &child, depth - 1, -beta, -alpha, ply + 1, &dummy, true);
                 }
             }
         }
         
         if (stop_search) return 0;
         
+        if (ply == 0) root_nodes[moves[i].hole - 1][moves[i].color] = stats.nodes_searched - nodes_before;
+        
         if (score > best_score) {
             best_score = score;
             local_best = moves[i];
@@ -422,31 +891,78 @@ static int negamax(GameState* game, int depth, int alpha, int beta, int ply,
             add_history(moves[i], depth);
             add_killer(moves[i], ply);
         }
+        int gain = sown[order[i]].gain;
         if (alpha >= beta) {
             // Coupure Beta
-            tt_store(hash, depth, best_score, LOWER_BOUND, local_best);
+            update_capture_history(moves[i], gain, depth, captures, capture_gains, n_captures);
+            if (depth <= MAX_DEPTH) {
+                stats.beta_cutoffs[depth]++;
+                if (i == 0) stats.first_move_cutoffs[depth]++;
+            }
+            if (!partial_root) {
+                PROF(PROF_TT_STORE, tt_store(hash, depth, best_score, LOWER_BOUND,
+                                             tt_move_to_canonical(local_best, rotation)));
+            }
             if (best_move) *best_move = local_best;
+            TRACE_SET(cut_index, i);
+            TRACE_END(TRACE_CUT_BETA, best_score);
             return best_score;
         }
+        if (gain > 0) {
+            captures[n_captures] = moves[i];
+            capture_gains[n_captures++] = gain;
+        }
     }
     
     // Sauvegarde dans la TT
     TTEntryType type = (best_score <= original_alpha) ? UPPER_BOUND : EXACT;
-    tt_store(hash, depth, best_score, type, local_best);
+    if (!partial_root) {
+        PROF(PROF_TT_STORE, tt_store(hash, depth, best_score, type, tt_move_to_canonical(local_best, rotation)));
+    }
     
     if (best_move) *best_move = local_best;
+    TRACE_END(TRACE_CUT_NONE, best_score);
     return best_score;
 }
 
+static int negamax_generic(GameState* game, int depth, int alpha, int beta, int ply,
+                           AIMove* best_move, bool allow_null) {
+    return negamax_side(game, depth, alpha, beta, ply, best_move, allow_null, 0);
+}
+
+static int negamax_p1(GameState* game, int depth, int alpha, int beta, int ply,
+                      AIMove* best_move, bool allow_null) {
+    return negamax_side(game, depth, alpha, beta, ply, best_move, allow_null, 1);
+}
+
+static int negamax_p2(GameState* game, int depth, int alpha, int beta, int ply,
+                      AIMove* best_move, bool allow_null) {
+    return negamax_side(game, depth, alpha, beta, ply, best_move, allow_null, 2);
+}
+
+// Racine : choix de la variante selon le camp au trait
+static int negamax(GameState* game, int depth, int alpha, int beta, int ply,
+                   AIMove* best_move, bool allow_null) {
+    if (!side_specialized) return negamax_generic(game, depth, alpha, beta, ply, best_move, allow_null);
+    if (game->current == 1) return negamax_p1(game, depth, alpha, beta, ply, best_move, allow_null);
+    return negamax_p2(game, depth, alpha, beta, ply, best_move, allow_null);
+}
+
 // ITERATIVE DEEPENING (Recherche itérative)
 
 
-static int iterative_deepening(GameState* game, int time_ms, AIMove* best_move) {
+static int iterative_deepening(GameState* game, const SearchLimits* limits, AIMove* best_move) {
     clock_t start = clock();
-    // On garde une marge de sécurité de 150ms pour pas perdre au temps
-    search_end_time = start + ((clock_t)(time_ms - 150) * CLOCKS_PER_SEC) / 1000;
+    use_time_limit = (limits->movetime_ms > 0);
+    search_end_time = start + ((clock_t)limits->movetime_ms * CLOCKS_PER_SEC) / 1000;
+    node_limit = limits->nodes;
+    external_stop = limits->stop;
+    root_exclude = limits->exclude;
+    root_n_exclude = limits->exclude ? limits->n_exclude : 0;
+    int max_depth = (limits->depth > 0 && limits->depth < MAX_DEPTH) ? limits->depth : MAX_DEPTH;
     
-    reset_search();
+    reset_search(game);
+    PROF_RESET();
     
     AIMove moves[64];
     int n = generate_legal_moves(&game->board, game->current, moves);
@@ -456,13 +972,16 @@ static int iterative_deepening(GameState* game, int time_ms, AIMove* best_move)
     }
     
     AIMove current_best = moves[0];
+    for (int i = 0; i < n && root_excluded(current_best); i++) current_best = moves[i];
     int current_score = 0;
     
     // On augmente la profondeur petit à petit
-    for (int depth = 1; depth <= MAX_DEPTH; depth++) {
-        if (clock() >= search_end_time || stop_search) break;
+    for (int depth = 1; depth <= max_depth; depth++) {
+        if ((use_time_limit && clock() >= search_end_time) || stop_search) break;
         
         stats.current_depth = depth;
+        PROF_DEPTH(depth);
+        TRACE_DEPTH(depth);
         
 
         // On réduit la fenêtre de recherche autour du score précédent pour aller plus vite
@@ -482,31 +1001,268 @@ static int iterative_deepening(GameState* game, int time_ms, AIMove* best_move)
         
         // Si le score sort de la fenêtre, on recommence avec l'infini
         if (score <= alpha || score >= beta) {
+            TRACE_ITERATION(depth, alpha, beta, score, (score <= alpha) ? TRACE_ASP_FAIL_LOW : TRACE_ASP_FAIL_HIGH);
             score = negamax(game, depth, -INFINITY_SCORE, INFINITY_SCORE, 0, &iter_best, true);
             if (stop_search) break;
+            TRACE_ITERATION(depth, -INFINITY_SCORE, INFINITY_SCORE, score, TRACE_ASP_INSIDE);
+        } else {
+            TRACE_ITERATION(depth, alpha, beta, score, TRACE_ASP_INSIDE);
         }
         
         current_score = score;
         current_best = iter_best;
+        root_nodes_valid = true;
+        
+        if (limits->report) {
+            SearchInfo info = {depth, score, stats.nodes_searched,
+                               (int)((clock() - start) * 1000 / CLOCKS_PER_SEC), current_best};
+            limits->report(&info);
+        }
         
         // Si on a trouvé une victoire quasi certaine, on arrête
         if (score > WIN_SCORE - 100) break;
     }
     
+    root_exclude = NULL;
+    root_n_exclude = 0;
     *best_move = current_best;
     return current_score;
 }
 
 
+// Points d'entrée pour les benchmarks (ai_advanced.h)
+int ai_evaluate(const Board* board, int player, const int scores[3]) {
+    return evaluate(board, player, scores, 0);
+}
+
+void ai_sort_moves(AIMove* moves, int n, AIMove tt_move, int ply, int depth, const Board* board, int player,
+                   const SownMove* sown) {
+    int order[64];
+    sort_moves(moves, n, tt_move, ply, board, 0, player, sown, order, depth);
+}
+
+void ai_set_side_specialization(bool enabled) {
+    side_specialized = enabled;
+}
+
+void ai_get_cutoff_stats(uint64_t beta_cutoffs[], uint64_t first_move_cutoffs[], int max_depth) {
+    for (int d = 0; d <= max_depth; d++) {
+        beta_cutoffs[d] = (d <= MAX_DEPTH) ? stats.beta_cutoffs[d] : 0;
+        first_move_cutoffs[d] = (d <= MAX_DEPTH) ? stats.first_move_cutoffs[d] : 0;
+    }
+}
+
+
+// ÉVALUATION PAR LOTS
+// Tout est calculé trou par trou pour toutes les positions à la fois, sur des octets (16
+// positions par registre SSE2), sans branche. Pour la mobilité et le potentiel de capture,
+// la dernière graine tombe à un trou différent pour chaque position : au lieu de lire ce
+// trou position par position, chaque coup essaie les 15 (rouges) ou 8 (bleues) arrivées
+// possibles et garde par masque le gain de la bonne, lu dans un tableau par trou d'arrivée.
+
+void ai_batch_set(EvalBatch* batch, int i, const Board* board, int player, const int scores[3]) {
+    for (int h = 0; h < N_HOLES; h++) {
+        batch->red[h][i] = (uint8_t)board->holes[h].red;
+        batch->blue[h][i] = (uint8_t)board->holes[h].blue;
+        batch->transparent[h][i] = (uint8_t)board->holes[h].transparent;
+    }
+    batch->player[i] = player;
+    batch->score1[i] = scores[1];
+    batch->score2[i] = scores[2];
+}
+
+// Comptes par trou puis par camp (parité 0 = trous du J1, 1 = trous du J2). Au plus 96
+// graines sur le plateau : tout tient sur un octet
+typedef struct {
+    uint8_t total[N_HOLES][EVAL_BATCH_MAX];
+    uint8_t gain[N_HOLES][EVAL_BATCH_MAX];   // Gain si la dernière graine tombe sur ce trou
+    uint8_t seeds[2][EVAL_BATCH_MAX], vulnerable[2][EVAL_BATCH_MAX], loaded[2][EVAL_BATCH_MAX];
+    uint8_t active[2][EVAL_BATCH_MAX];
+    uint8_t mobility[2][EVAL_BATCH_MAX], potential[2][EVAL_BATCH_MAX];
+} BatchCounts;
+
+// Le coup compte, et son gain entre dans le potentiel s'il fait partie des 10 premiers
+// coups générés (même règle que side_mobility_potential())
+static FORCE_INLINE void batch_tally(uint8_t* moves, uint8_t* best, int k, uint8_t legal, uint8_t g) {
+    g &= (uint8_t)-(legal & (moves[k] < 10));
+    best[k] = (g > best[k]) ? g : best[k];
+    moves[k] += legal;
+}
+
+static const uint8_t batch_zero[EVAL_BATCH_MAX];
+
+// Un coup de chaque position du lot depuis le trou h : a + b graines, joué si exists > 0.
+// Masques plutôt que ?: sur les lectures, une boucle par règle d'arrivée, restrict : sans
+// quoi gcc ne vectorise pas (branches dans la boucle, tests de recouvrement)
+static void batch_move(const uint8_t (*restrict gain)[EVAL_BATCH_MAX], uint8_t* restrict moves,
+                       uint8_t* restrict best, int h, const uint8_t* restrict a, const uint8_t* restrict b,
+                       const uint8_t* restrict exists, bool opponent, int n) {
+    if (opponent) {
+        for (int k = 0; k < n; k++) {
+            uint8_t step = (uint8_t)(a[k] + b[k] - 1) & 7;
+            uint8_t g = 0;
+            for (int d = 0; d < 8; d++) g |= gain[(h + 1 + 2 * d) & 15][k] & (uint8_t)-(step == d);
+            batch_tally(moves, best, k, exists[k] != 0, g);
+        }
+    } else {
+        for (int k = 0; k < n; k++) {
+            // (seeds - 1) % 15, seeds <= 64
+            uint8_t step = (uint8_t)(a[k] + b[k] - 1);
+            step -= 60 & (uint8_t)-(step >= 60);
+            step -= 30 & (uint8_t)-(step >= 30);
+            step -= 15 & (uint8_t)-(step >= 15);
+            uint8_t g = 0;
+            for (int d = 0; d < 15; d++) g |= gain[(h + 1 + d) & 15][k] & (uint8_t)-(step == d);
+            batch_tally(moves, best, k, exists[k] != 0, g);
+        }
+    }
+}
+
+static FORCE_INLINE void batch_counts(const EvalBatch* batch, BatchCounts* c) {
+    int n = batch->count;
+    memset(c->seeds, 0, sizeof(c->seeds));
+    memset(c->vulnerable, 0, sizeof(c->vulnerable));
+    memset(c->loaded, 0, sizeof(c->loaded));
+    memset(c->active, 0, sizeof(c->active));
+    memset(c->mobility, 0, sizeof(c->mobility));
+    memset(c->potential, 0, sizeof(c->potential));
+    for (int h = 0; h < N_HOLES; h++) {
+        int q = h & 1;
+        for (int k = 0; k < n; k++) {
+            uint8_t s = batch->red[h][k] + batch->blue[h][k] + batch->transparent[h][k];
+            c->total[h][k] = s;
+            c->gain[h][k] = (s == 1 || s == 2) ? s + 1 : 0;
+            c->seeds[q][k] += s;
+            c->vulnerable[q][k] += (s == 1) | (s == 2);
+            c->loaded[q][k] += (s >= 6);
+            c->active[q][k] += (s >= 2) & (s <= 10);
+        }
+    }
+    // Coups dans l'ordre de generate_legal_moves : R, B, puis TR et TB
+    for (int h = 0; h < N_HOLES; h++) {
+        int q = h & 1;
+        const uint8_t *r = batch->red[h], *b = batch->blue[h], *t = batch->transparent[h];
+        const uint8_t(*gain)[EVAL_BATCH_MAX] = (const uint8_t(*)[EVAL_BATCH_MAX])c->gain;
+        uint8_t *moves = c->mobility[q], *best = c->potential[q];
+        batch_move(gain, moves, best, h, r, batch_zero, r, false, n);
+        batch_move(gain, moves, best, h, b, batch_zero, b, true, n);
+        batch_move(gain, moves, best, h, t, r, t, false, n);
+        batch_move(gain, moves, best, h, t, b, t, true, n);
+    }
+}
+
+// Termes avant pondération d'une position (mêmes conditions que evaluate()) ;
+// renvoie 1 pour une fin de partie, dont la note fixe est dans *terminal_eval
+static FORCE_INLINE int batch_terms(const EvalBatch* batch, const BatchCounts* c, int k, int f[EVAL_PARAMS],
+                                    int* terminal_eval) {
+    int me = batch->player[k] - 1, opp = 1 - me;
+    int my_score = me ? batch->score2[k] : batch->score1[k];
+    int opp_score = me ? batch->score1[k] : batch->score2[k];
+    int my_seeds = c->seeds[me][k], opp_seeds = c->seeds[opp][k];
+
+    // Fins de partie, dans l'ordre des tests de evaluate() (ply 0)
+    if (my_score >= 49) return *terminal_eval = WIN_SCORE, 1;
+    if (opp_score >= 49) return *terminal_eval = -WIN_SCORE, 1;
+    if (my_score == 48 && opp_score == 48) return *terminal_eval = 0, 1;
+    if (my_seeds + opp_seeds < 10) {
+        *terminal_eval = (my_score > opp_score) ? WIN_SCORE : (opp_score > my_score ? -WIN_SCORE : 0);
+        return 1;
+    }
+
+    int my_mobility = c->mobility[me][k], opp_mobility = c->mobility[opp][k];
+    int my_potential = c->potential[me][k], opp_potential = c->potential[opp][k];
+
+    int total_captured = my_score + opp_score;
+    int early = total_captured < 20, late = total_captured >= 60, mid = !early & !late;
+    int score_diff = my_score - opp_score;
+    int mobility_diff = my_mobility - opp_mobility;
+    int potential_diff = my_potential - opp_potential;
+
+    f[EP_TEMPO_EARLY] = early;
+    f[EP_TEMPO_LATE] = !early;
+    f[EP_SCORE_EARLY] = early * score_diff;
+    f[EP_SCORE_MID] = mid * score_diff;
+    f[EP_SCORE_LATE] = late * score_diff;
+    f[EP_SEEDS] = my_seeds - opp_seeds;
+    f[EP_THRESHOLD] = (my_score >= 40 ? my_score - 39 : 0) - (opp_score >= 40 ? opp_score - 39 : 0);
+    f[EP_FAMINE_SELF] = -(my_seeds < 5 && opp_seeds > 10);
+    f[EP_FAMINE_OPP] = (opp_seeds < 5 && my_seeds > 10);
+    f[EP_SEED_LEAD_EARLY] = early & (my_seeds > opp_seeds + 3);
+    f[EP_VULNERABLE] = c->vulnerable[opp][k] - c->vulnerable[me][k];
+    f[EP_LOADED] = c->loaded[me][k] - c->loaded[opp][k];
+    f[EP_ACTIVE_EARLY] = early * c->active[me][k];
+    f[EP_MOBILITY_EARLY] = early * mobility_diff;
+    f[EP_MOBILITY_LATE] = !early * mobility_diff;
+    f[EP_POTENTIAL_EARLY] = early * potential_diff;
+    f[EP_POTENTIAL_LATE] = !early * potential_diff;
+    return 0;
+}
+
+void ai_evaluate_features(const EvalBatch* batch, EvalFeatures* out) {
+    // Comptes sur la pile (~10 Ko) : plusieurs threads peuvent évaluer en parallèle
+    BatchCounts counts;
+    batch_counts(batch, &counts);
+    for (int k = 0; k < batch->count; k++) {
+        int f[EVAL_PARAMS] = {0};
+        out->terminal[k] = batch_terms(batch, &counts, k, f, &out->terminal_eval[k]);
+        for (int p = 0; p < EVAL_PARAMS; p++) out->feature[p][k] = f[p];
+    }
+}
+
+// Note = somme des poids x termes, sans ranger les termes du lot
+void ai_evaluate_batch(const EvalBatch* batch, int* out) {
+    BatchCounts counts;
+    batch_counts(batch, &counts);
+    const int* w = eval_params;
+    for (int k = 0; k < batch->count; k++) {
+        int f[EVAL_PARAMS], terminal_eval;
+        if (batch_terms(batch, &counts, k, f, &terminal_eval)) {
+            out[k] = terminal_eval;
+            continue;
+        }
+        int eval = 0;
+        for (int p = 0; p < EVAL_PARAMS; p++) eval += w[p] * f[p];
+        out[k] = eval;
+    }
+}
+
+
 // MAIN / INTERFACE
 
 
-static int advanced_get_best_move(GameState* game, int time_ms, AIMove* best_move) {
+// Victoire prouvée par le solveur : entrée exacte plus profonde que toute recherche,
+// la recherche la lit dès la racine (et dans les arbres des coups suivants).
+// La clé de la TT ignore le nombre de coups joués : on ne range la preuve que si la limite
+// des 400 coups est hors de l'horizon du solveur (sinon elle n'est vraie qu'à ce compte)
+static void store_proven(const GameState* game, int score, AIMove move) {
+    if (400 - game->total_moves <= PN_MAX_PLY) return;
+#ifdef TT_SYMMETRY
+    int rotation;
+    uint64_t hash = zobrist_hash_canonical(&game->board, game->current, game->score, &rotation);
+#else
+    int rotation = 0;
+    uint64_t hash = zobrist_hash(&game->board, game->current, game->score);
+#endif
+    tt_store(hash, PROVEN_DEPTH, score, EXACT, tt_move_to_canonical(move, rotation));
+}
+
+static int advanced_search(GameState* game, const SearchLimits* limits, AIMove* best_move) {
     AIMove moves[64];
     int n = generate_legal_moves(&game->board, game->current, moves);
+
+    // Multipv : on ne garde que les coups non exclus
+    bool multipv = limits->exclude && limits->n_exclude > 0;
+    root_exclude = limits->exclude;
+    root_n_exclude = multipv ? limits->n_exclude : 0;
+    int kept = 0;
+    for (int i = 0; i < n; i++) {
+        if (!root_excluded(moves[i])) moves[kept++] = moves[i];
+    }
+    n = kept;
+    root_n_exclude = 0;
     
-    // Si un seul coup possible, on ne réfléchit pas
-    if (n == 1) {
+    // Si un seul coup possible, on ne réfléchit pas (sauf en multipv, où il faut son score)
+    if (n == 1 && !multipv) {
         *best_move = moves[0];
         return 0; 
     }
@@ -515,13 +1271,84 @@ static int advanced_get_best_move(GameState* game, int time_ms, AIMove* best_mov
         return -INFINITY_SCORE;
     }
 
+    // Fin de partie proche : le solveur a une part du temps (ou des noeuds) pour prouver une
+    // victoire forcée. Pas de solveur pour une recherche limitée seulement en profondeur
+    // (self-play, "go depth") : son budget fixe coûterait bien plus que la recherche
+    SearchLimits search_limits = *limits;
+    bool depth_only = limits->depth > 0 && limits->movetime_ms <= 0 && limits->nodes == 0;
+    uint64_t budget = limits->nodes > 0 ? limits->nodes * (uint64_t)pn_config.slice_percent / 100
+                      : limits->movetime_ms > 0 ? 0 : pn_config.max_nodes;
+    bool budget_ok = limits->nodes == 0 || budget > 0;
+    if (pn_should_solve(game) && !multipv && !depth_only && budget_ok) {
+        clock_t start = clock();
+        int slice_ms = limits->movetime_ms * pn_config.slice_percent / 100;
+        AIMove proven_move;
+        uint64_t nodes;
+        PnResult result = pn_solve(game, budget, slice_ms, limits->stop, &proven_move, &nodes);
+        solver_stats.calls++;
+        solver_stats.nodes += nodes;
+        if (result == PN_WIN) {
+            solver_stats.proven++;
+            store_proven(game, PROVEN_WIN_SCORE, proven_move);
+        }
+        if (limits->movetime_ms > 0) {
+            int spent = (int)((clock() - start) * 1000 / CLOCKS_PER_SEC);
+            search_limits.movetime_ms = (limits->movetime_ms - spent > 1) ? limits->movetime_ms - spent : 1;
+        }
+        // Les noeuds du solveur comptent dans la limite de la recherche
+        if (limits->nodes > 0) search_limits.nodes = (limits->nodes > nodes + 1) ? limits->nodes - nodes : 1;
+    }
+
     // Sinon on lance la recherche
-    int score = iterative_deepening(game, time_ms, best_move);
+    int score = iterative_deepening(game, &search_limits, best_move);
+    PROF_REPORT();
     return score;
 }
 
+static int advanced_get_best_move(GameState* game, int time_ms, AIMove* best_move) {
+    // On garde une marge de sécurité de 150ms pour pas perdre au temps
+    SearchLimits limits = {0};
+    limits.movetime_ms = (time_ms > 300) ? time_ms - 150 : time_ms / 2;
+    return advanced_search(game, &limits, best_move);
+}
+
+static void advanced_print_stats(void) {
+    uint64_t probes = eval_cache_stats.hits + eval_cache_stats.misses;
+    fprintf(stderr, "Noeuds: %llu, prof max: %d, TT cutoffs: %llu, null cutoffs: %llu, LMR: %llu\n",
+            (unsigned long long)stats.nodes_searched, stats.max_depth_reached,
+            (unsigned long long)stats.tt_cutoffs, (unsigned long long)stats.null_cutoffs,
+            (unsigned long long)stats.lmr_reductions);
+    fprintf(stderr, "Elagage: futility %llu, razoring %llu, ProbCut %llu\n",
+            (unsigned long long)stats.futility_prunes, (unsigned long long)stats.razor_cutoffs,
+            (unsigned long long)stats.probcut_cutoffs);
+    fprintf(stderr, "Coupures au 1er coup (prof restante):");
+    for (int d = 1; d <= MAX_DEPTH; d++) {
+        if (stats.beta_cutoffs[d]) {
+            fprintf(stderr, " %d:%.0f%%", d,
+                    100.0 * (double)stats.first_move_cutoffs[d] / (double)stats.beta_cutoffs[d]);
+        }
+    }
+    fprintf(stderr, "\n");
+    fprintf(stderr, "Cache eval: %llu hits / %llu probes (%.1f%%)\n",
+            (unsigned long long)eval_cache_stats.hits, (unsigned long long)probes,
+            probes ? 100.0 * (double)eval_cache_stats.hits / (double)probes : 0.0);
+    if (solver_stats.calls) {
+        fprintf(stderr, "Solveur: %llu appels, %llu victoires prouvées, %llu noeuds\n",
+                (unsigned long long)solver_stats.calls, (unsigned long long)solver_stats.proven,
+                (unsigned long long)solver_stats.nodes);
+    }
+}
+
+static void advanced_new_game(void) {
+    memset(killer_moves, 0, sizeof(killer_moves));
+    last_root_moves = -1;
+    memset(history_scores, 0, sizeof(history_scores));
+    memset(capture_history, 0, sizeof(capture_history));
+    memset(&solver_stats, 0, sizeof(solver_stats));
+}
+
 static void advanced_init(void) {
-    // Rien de spécial à initialiser ici
+    advanced_new_game();
 }
 
 static void advanced_cleanup(void) {}
@@ -531,7 +1358,10 @@ AIPlayer AI_Advanced = {
     .name = "Advanced",
     .description = "Negamax + NMP + LMR + Aspiration + TT",
     .get_best_move = advanced_get_best_move,
+    .search = advanced_search,
+    .new_game = advanced_new_game,
     .init = advanced_init,
     .cleanup = advanced_cleanup,
+    .print_stats = advanced_print_stats,
 
 };
\ No newline at end of file
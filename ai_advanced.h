@@ -0,0 +1,69 @@
+#ifndef AI_ADVANCED_H
+#define AI_ADVANCED_H
+
+#include "ai.h"
+#include "eval_params.h"
+
+// Accès direct aux noyaux internes de l'IA Advanced (pour les benchmarks)
+// Le jeu passe uniquement par AI_Advanced (ai_interface.h)
+
+int  ai_evaluate(const Board* board, int player, const int scores[3]);
+// Tri d'un noeud intérieur : sown vient de expand_moves() sur les mêmes coups, depth est la
+// profondeur restante (l'échange statique n'est calculé qu'assez loin des feuilles)
+void ai_sort_moves(AIMove* moves, int n, AIMove tt_move, int ply, int depth, const Board* board, int player,
+                   const SownMove* sown);
+
+// Recherche avec les noyaux spécialisés par camp (par défaut) ou génériques (comparaison)
+void ai_set_side_specialization(bool enabled);
+
+// Qualité du tri pour la dernière recherche : coupures beta et coupures au premier coup,
+// par profondeur restante (indices 0..max_depth)
+void ai_get_cutoff_stats(uint64_t beta_cutoffs[], uint64_t first_move_cutoffs[], int max_depth);
+
+// ÉLAGAGE SÉLECTIF près des feuilles (noeuds hors variante principale)
+// Marges en points d'évaluation ; une marge à 0 désactive la technique
+typedef struct {
+    int futility_margin;    // Futility : coup ignoré si éval statique + marge x prof + gain ne passe pas alpha
+    int futility_capture;   // Valeur d'une graine capturée dans ce test
+    int futility_depth;     // Profondeur max
+    int razor_margin;       // Razoring : éval + marge x prof <= alpha => vérification à profondeur 1
+    int razor_depth;
+    int probcut_margin;     // ProbCut : une capture tient beta + marge à prof - réduction => coupure
+    int probcut_depth;      // Profondeur min
+    int probcut_reduction;
+} PruneConfig;
+
+extern PruneConfig prune_config;
+
+// ÉVALUATION PAR LOTS (réglage des poids, étiquetage de données)
+// Les positions sont rangées en structure de tableaux : pour chaque trou et chaque couleur,
+// les graines des N positions sont contiguës (un octet par trou : 16 positions par registre SSE2).
+// Même résultat que ai_evaluate() position par position, environ 3x plus vite (microbench).
+
+#define EVAL_BATCH_MAX 256
+
+typedef struct {
+    int count;
+    uint8_t red[N_HOLES][EVAL_BATCH_MAX];
+    uint8_t blue[N_HOLES][EVAL_BATCH_MAX];
+    uint8_t transparent[N_HOLES][EVAL_BATCH_MAX];
+    int player[EVAL_BATCH_MAX];
+    int score1[EVAL_BATCH_MAX];
+    int score2[EVAL_BATCH_MAX];
+} EvalBatch;
+
+// Range une position dans le lot (index i < EVAL_BATCH_MAX)
+void ai_batch_set(EvalBatch* batch, int i, const Board* board, int player, const int scores[3]);
+void ai_evaluate_batch(const EvalBatch* batch, int* out);
+
+// Termes de l'évaluation avant pondération (réglage des poids, tune.c) : hors fins de partie,
+// la note est la somme des eval_params[p] * feature[p]
+typedef struct {
+    int feature[EVAL_PARAMS][EVAL_BATCH_MAX];
+    int terminal[EVAL_BATCH_MAX];       // Fin de partie : note fixe (terminal_eval), sans poids
+    int terminal_eval[EVAL_BATCH_MAX];
+} EvalFeatures;
+
+void ai_evaluate_features(const EvalBatch* batch, EvalFeatures* out);
+
+#endif // AI_ADVANCED_H
@@ -16,6 +16,15 @@ typedef struct AIPlayer {
     
     int (*get_best_move)(GameState* game, int time_limit_ms, AIMove* best_move);
     
+    // Recherche avec limites (profondeur, temps, noeuds) et arrêt externe
+    
+    int (*search)(GameState* game, const SearchLimits* limits, AIMove* best_move);
+    
+    
+    // Nouvelle partie : oublie les heuristiques apprises (killers, historique)
+    
+    void (*new_game)(void);
+    
     
     //Initialise les structures de l'IA (TT, tables, etc.)
     
@@ -33,5 +42,6 @@ typedef struct AIPlayer {
 } AIPlayer;
 
 extern AIPlayer AI_Advanced;   // IA Ultra Optimisée
+extern AIPlayer AI_MCTS;       // Monte-Carlo (UCT) multithread
 
 #endif // AI_INTERFACE_H
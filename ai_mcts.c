@@ -0,0 +1,409 @@
+#define _POSIX_C_SOURCE 200112L
+#include "ai_interface.h"
+#include "ai.h"
+#include "ai_mcts.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#endif
+
+// MONTE-CARLO TREE SEARCH (UCT)
+// Deuxième IA, interchangeable avec Advanced via ai_interface.h.
+// - les noeuds viennent d'un pool préalloué (allocation = un incrément atomique)
+// - plusieurs threads descendent le même arbre ; chaque passage compte tout de suite
+//   une visite sans gain ("virtual loss") pour écarter les autres threads du même chemin
+// - l'arbre du coup précédent est réutilisé si la nouvelle position y figure
+
+
+// CONSTANTES
+
+
+#define MCTS_POOL_SIZE (1 << 21)      // 2M noeuds de 32 octets = 64 Mo
+#define MCTS_MAX_THREADS 64
+#define MCTS_EXPAND_VISITS 4          // Une feuille est développée après ce nombre de visites
+#define MCTS_UCT_C 1.0                // Constante d'exploration
+#define MCTS_SAFETY_MS 150            // Marge de sécurité pour l'arbitre
+
+// Un noeud de l'arbre. Les gains sont en demi-points (victoire = 2, nul = 1)
+// du point de vue du joueur qui a joué move pour arriver ici
+typedef struct {
+    AIMove move;
+    int first_child;                  // Index du premier enfant dans le pool
+    int n_children;
+    int expanded;                     // 0 = feuille, 1 = en cours, 2 = développé
+    int visits;
+    int64_t wins;
+} MCTSNode;
+
+static MCTSNode* pool = NULL;
+static int pool_used = 0;
+
+// Racine courante (gardée d'un coup à l'autre pour réutiliser l'arbre)
+static int root_index = -1;
+static GameState root_game;
+
+static int n_threads = 1;
+
+// État partagé d'une recherche
+static struct {
+    GameState game;
+    uint64_t end_ms;
+    bool use_time_limit;
+    uint64_t playout_limit;
+    volatile bool* external_stop;
+    volatile bool stop;
+    uint64_t playouts;
+    int max_depth;
+} search;
+
+
+// OUTILS
+
+
+// Horloge murale en ms (clock() additionne le CPU de tous les threads sous Linux)
+static uint64_t now_ms(void) {
+#ifdef _WIN32
+    return (uint64_t)GetTickCount64();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+#endif
+}
+
+static inline uint64_t xorshift64(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+// Réserve n noeuds consécutifs, renvoie -1 si le pool est plein
+static int pool_alloc(int n) {
+    int index = __atomic_fetch_add(&pool_used, n, __ATOMIC_RELAXED);
+    if (index + n > MCTS_POOL_SIZE) return -1;
+    return index;
+}
+
+static int new_root(void) {
+    int index = pool_alloc(1);
+    if (index < 0) return -1;
+    memset(&pool[index], 0, sizeof(MCTSNode));
+    return index;
+}
+
+// Résultat d'une partie finie pour le joueur donné (en demi-points)
+static int result_for(const GameState* game, int player) {
+    int opponent = (player == 1) ? 2 : 1;
+    if (game->score[player] > game->score[opponent]) return 2;
+    if (game->score[player] < game->score[opponent]) return 0;
+    return 1;
+}
+
+
+// PLAYOUT RAPIDE
+// Coups tirés au hasard sans générer la liste complète : on choisit un trou du joueur
+// qui a des graines, puis une couleur jouable. Les règles passent par apply_move
+// (sow_and_capture + affamation + limite des 400 coups).
+
+
+static bool random_move(const Board* board, int player, uint64_t* rng, AIMove* move) {
+    int start = (int)(xorshift64(rng) & 7);
+    for (int k = 0; k < 8; k++) {
+        int hole = (((start + k) & 7) << 1) + (player - 1);
+        const Hole* h = &board->holes[hole];
+        if (h->red + h->blue + h->transparent == 0) continue;
+
+        Color colors[4];
+        int n = 0;
+        if (h->red > 0) colors[n++] = RED;
+        if (h->blue > 0) colors[n++] = BLUE;
+        if (h->transparent > 0) {
+            colors[n++] = T_AS_RED;
+            colors[n++] = T_AS_BLUE;
+        }
+        move->hole = hole + 1;
+        move->color = colors[xorshift64(rng) % n];
+        return true;
+    }
+    return false;
+}
+
+static int rollout(GameState* game, int player, uint64_t* rng) {
+    AIMove move;
+    while (!game_over(game)) {
+        if (!random_move(&game->board, game->current, rng, &move)) break;
+        apply_move(game, move);
+    }
+    return result_for(game, player);
+}
+
+
+// ARBRE
+
+
+// Développe un noeud : un seul thread y arrive (CAS sur expanded)
+static void expand(int index, const GameState* game) {
+    MCTSNode* node = &pool[index];
+    int expected = 0;
+    if (!__atomic_compare_exchange_n(&node->expanded, &expected, 1, false,
+                                     __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return;
+    }
+
+    AIMove moves[64];
+    int n = generate_legal_moves(&game->board, game->current, moves);
+    int first = (n > 0) ? pool_alloc(n) : -1;
+    if (first < 0) {
+        // Pool plein ou pas de coup : le noeud reste une feuille
+        __atomic_store_n(&node->expanded, 0, __ATOMIC_RELEASE);
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        MCTSNode* child = &pool[first + i];
+        memset(child, 0, sizeof(MCTSNode));
+        child->move = moves[i];
+    }
+    node->first_child = first;
+    node->n_children = n;
+    __atomic_store_n(&node->expanded, 2, __ATOMIC_RELEASE);
+}
+
+// Choix UCT parmi les enfants (un enfant jamais visité passe en premier)
+static int select_child(int index, uint64_t* rng) {
+    MCTSNode* node = &pool[index];
+    int parent_visits = __atomic_load_n(&node->visits, __ATOMIC_RELAXED);
+    double log_n = log((double)(parent_visits + 1));
+
+    int best = -1;
+    double best_value = -1.0;
+    int offset = (int)(xorshift64(rng) % node->n_children); // Départage des non visités
+    for (int k = 0; k < node->n_children; k++) {
+        int c = node->first_child + (offset + k) % node->n_children;
+        int visits = __atomic_load_n(&pool[c].visits, __ATOMIC_RELAXED);
+        if (visits == 0) return c;
+
+        double q = (double)__atomic_load_n(&pool[c].wins, __ATOMIC_RELAXED) / (2.0 * visits);
+        double value = q + MCTS_UCT_C * sqrt(log_n / visits);
+        if (value > best_value) {
+            best_value = value;
+            best = c;
+        }
+    }
+    return best;
+}
+
+// Un playout complet : descente, développement, simulation, remontée
+static void playout(uint64_t* rng) {
+    int path[512];
+    int depth = 0;
+    GameState game = search.game;
+
+    int index = root_index;
+    path[depth++] = index;
+    __atomic_fetch_add(&pool[index].visits, 1, __ATOMIC_RELAXED);
+
+    while (!game_over(&game) && depth < 512) {
+        MCTSNode* node = &pool[index];
+        int state = __atomic_load_n(&node->expanded, __ATOMIC_ACQUIRE);
+        if (state != 2) {
+            if (state == 0 && node->visits >= MCTS_EXPAND_VISITS) expand(index, &game);
+            if (__atomic_load_n(&node->expanded, __ATOMIC_ACQUIRE) != 2) break;
+        }
+
+        index = select_child(index, rng);
+        apply_move(&game, pool[index].move);
+        path[depth++] = index;
+        // Virtual loss : la visite compte tout de suite, le gain arrive à la remontée
+        __atomic_fetch_add(&pool[index].visits, 1, __ATOMIC_RELAXED);
+    }
+
+    // Le résultat est vu par le joueur qui vient de jouer le coup du noeud final
+    int mover = (game.current == 1) ? 2 : 1;
+    int result = rollout(&game, mover, rng);
+
+    // Remontée : le point de vue change à chaque niveau
+    for (int d = depth - 1; d >= 0; d--) {
+        __atomic_fetch_add(&pool[path[d]].wins, result, __ATOMIC_RELAXED);
+        result = 2 - result;
+    }
+
+    if (depth > search.max_depth) search.max_depth = depth;
+}
+
+static bool should_stop(void) {
+    if (search.stop) return true;
+    if ((search.use_time_limit && now_ms() >= search.end_ms) ||
+        (search.external_stop && *search.external_stop) ||
+        (search.playout_limit && __atomic_load_n(&search.playouts, __ATOMIC_RELAXED) >= search.playout_limit)) {
+        search.stop = true;
+    }
+    return search.stop;
+}
+
+static void* worker(void* arg) {
+    uint64_t rng = 0x9E3779B97F4A7C15ULL * ((uint64_t)(intptr_t)arg + 1) ^ now_ms();
+    while (!should_stop()) {
+        for (int i = 0; i < 64; i++) playout(&rng);
+        __atomic_fetch_add(&search.playouts, 64, __ATOMIC_RELAXED);
+    }
+    return NULL;
+}
+
+
+// RÉUTILISATION DE L'ARBRE
+// On cherche la nouvelle position parmi les enfants et petits-enfants de l'ancienne racine
+// (notre coup puis celui de l'adversaire)
+
+
+static bool same_position(const GameState* a, const GameState* b) {
+    return a->current == b->current && a->score[1] == b->score[1] && a->score[2] == b->score[2] &&
+           memcmp(&a->board, &b->board, sizeof(Board)) == 0;
+}
+
+static int find_subtree(int index, const GameState* game, const GameState* target, int plies) {
+    if (same_position(game, target)) return index;
+    if (plies == 0 || pool[index].expanded != 2) return -1;
+
+    for (int i = 0; i < pool[index].n_children; i++) {
+        int c = pool[index].first_child + i;
+        GameState child = *game;
+        apply_move(&child, pool[c].move);
+        int found = find_subtree(c, &child, target, plies - 1);
+        if (found >= 0) return found;
+    }
+    return -1;
+}
+
+static void prepare_root(const GameState* game) {
+    int reused = -1;
+    // Si le pool est déjà à moitié plein, on repart de zéro plutôt que de manquer de place
+    if (root_index >= 0 && pool_used < MCTS_POOL_SIZE / 2) {
+        reused = find_subtree(root_index, &root_game, game, 2);
+    }
+    if (reused < 0) {
+        pool_used = 0;
+        reused = new_root();
+    }
+    root_index = reused;
+    root_game = *game;
+}
+
+
+// INTERFACE
+
+
+static int mcts_search(GameState* game, const SearchLimits* limits, AIMove* best_move) {
+    AIMove moves[64];
+    int n = generate_legal_moves(&game->board, game->current, moves);
+    if (n == 0) {
+        best_move->hole = 0;
+        return 0;
+    }
+    if (n == 1) {
+        *best_move = moves[0];
+        return 0;
+    }
+
+    uint64_t start = now_ms();
+    prepare_root(game);
+    search.game = *game;
+    search.use_time_limit = (limits->movetime_ms > 0);
+    search.end_ms = start + (uint64_t)limits->movetime_ms;
+    search.playout_limit = limits->nodes;
+    search.external_stop = limits->stop;
+    search.stop = false;
+    search.playouts = 0;
+    search.max_depth = 0;
+
+    // Sans aucune limite, on s'arrête quand même (sinon seul "stop" le ferait)
+    if (!search.use_time_limit && !search.playout_limit && !search.external_stop) {
+        search.playout_limit = 100000;
+    }
+
+    pthread_t threads[MCTS_MAX_THREADS];
+    int started = 0;
+    for (int t = 1; t < n_threads; t++) {
+        if (pthread_create(&threads[started], NULL, worker, (void*)(intptr_t)t) == 0) started++;
+    }
+    worker((void*)(intptr_t)0);
+    for (int t = 0; t < started; t++) pthread_join(threads[t], NULL);
+
+    // Le coup le plus visité
+    MCTSNode* root = &pool[root_index];
+    int best = -1;
+    for (int i = 0; i < root->n_children; i++) {
+        int c = root->first_child + i;
+        if (best < 0 || pool[c].visits > pool[best].visits) best = c;
+    }
+    *best_move = (best >= 0) ? pool[best].move : moves[0];
+
+    int score = 0;
+    if (best >= 0 && pool[best].visits > 0) {
+        // Taux de victoire ramené sur l'échelle de l'évaluation (-1000 .. 1000)
+        score = (int)(1000.0 * ((double)pool[best].wins / pool[best].visits - 1.0));
+    }
+
+    if (limits->report) {
+        SearchInfo info = {search.max_depth, score, search.playouts, (int)(now_ms() - start), *best_move};
+        limits->report(&info);
+    }
+    return score;
+}
+
+static int mcts_get_best_move(GameState* game, int time_ms, AIMove* best_move) {
+    SearchLimits limits = {0};
+    limits.movetime_ms = (time_ms > 2 * MCTS_SAFETY_MS) ? time_ms - MCTS_SAFETY_MS : time_ms / 2;
+    return mcts_search(game, &limits, best_move);
+}
+
+static void mcts_new_game(void) {
+    root_index = -1;
+    pool_used = 0;
+}
+
+static void mcts_init(void) {
+    if (!pool) {
+        pool = (MCTSNode*)malloc(sizeof(MCTSNode) * MCTS_POOL_SIZE);
+        if (!pool) exit(1); // Erreur critique si plus de RAM
+    }
+    mcts_new_game();
+}
+
+static void mcts_cleanup(void) {
+    free(pool);
+    pool = NULL;
+    root_index = -1;
+}
+
+static void mcts_print_stats(void) {
+    fprintf(stderr, "MCTS: %llu playouts, %d threads, prof max %d, pool %d/%d noeuds\n",
+            (unsigned long long)search.playouts, n_threads, search.max_depth,
+            pool_used < MCTS_POOL_SIZE ? pool_used : MCTS_POOL_SIZE, MCTS_POOL_SIZE);
+}
+
+void mcts_set_threads(int threads) {
+    n_threads = (threads < 1) ? 1 : (threads > MCTS_MAX_THREADS ? MCTS_MAX_THREADS : threads);
+}
+
+AIPlayer AI_MCTS = {
+    .name = "MCTS",
+    .description = "UCT multithread + virtual loss + réutilisation de l'arbre",
+    .get_best_move = mcts_get_best_move,
+    .search = mcts_search,
+    .new_game = mcts_new_game,
+    .init = mcts_init,
+    .cleanup = mcts_cleanup,
+    .print_stats = mcts_print_stats,
+};
@@ -0,0 +1,9 @@
+#ifndef AI_MCTS_H
+#define AI_MCTS_H
+
+// Réglages de l'IA MCTS (le jeu passe par AI_MCTS, ai_interface.h)
+
+// Nombre de threads de recherche (1 par défaut)
+void mcts_set_threads(int threads);
+
+#endif // AI_MCTS_H
@@ -0,0 +1,622 @@
+// Benchmark de la recherche
+// Mesure le temps de démarrage (jusqu'au premier coup) puis, sur une série de
+// positions fixes, le temps pour atteindre chaque profondeur, les noeuds et le NPS.
+// Usage : bench.exe [profondeur]
+//         bench.exe rules [parties]  (vérifie que la recherche et l'arbitre ont les mêmes règles)
+//         bench.exe perft [profondeur] (compte les feuilles de l'arbre des coups)
+//         bench.exe side [profondeur]  (noyaux génériques contre noyaux spécialisés par camp)
+//         bench.exe solve [positions]  (solveur de fin de partie contre recherche à profondeur fixe)
+//         bench.exe match [parties] [ms]  (élagage sélectif contre sans, à temps fixe par coup)
+//         bench.exe random [positions] [profondeur] (positions tirées de parties aléatoires)
+//         bench.exe --eval-params <fichier> ... (poids de l'évaluation, cf. tune.c)
+//         bench.exe --futility|--razoring|--probcut <marge> ... (élagage sélectif, 0 = désactivé)
+// Les compteurs matériels (perf_event_open) sont affichés s'ils sont disponibles.
+#include "ai.h"
+#include "ai_advanced.h"
+#include "ai_interface.h"
+#include "eval_params.h"
+#include "game.h"
+#include "perf_counters.h"
+#include "pn_search.h"
+#include "sow_and_capture.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_DEFAULT_DEPTH 9
+#define BENCH_SEQUENCE_PLIES 20
+#define PERFT_DEFAULT_DEPTH 5
+#define SOLVE_SEARCH_DEPTH 10
+#define MATCH_RANDOM_PLIES 6
+#define RANDOM_MIN_PLIES 4
+#define RANDOM_MAX_PLIES 43
+#define WIN_SCORE_BENCH 100000  // WIN_SCORE de ai_advanced.c
+
+// Positions de test (notation de game_from_string), de l'ouverture à la fin de partie
+static const char* bench_positions[] = {
+    "2.2.2/2.2.2/2.2.2/2.2.2/2.2.2/2.2.2/2.2.2/2.2.2/2.2.2/2.2.2/2.2.2/2.2.2/2.2.2/2.2.2/2.2.2/2.2.2 1 0 0 0",
+    "0.2.2/3.2.2/3.2.2/0.2.2/3.2.2/1.2.2/0.2.2/4.2.2/1.2.2/4.2.2/1.2.2/0.2.2/4.2.2/1.2.2/4.2.2/3.2.2 1 0 0 8",
+    "0.2.2/0.2.2/2.2.2/1.2.2/7.0.0/0.3.3/0.2.2/7.3.3/0.2.2/0.2.2/2.0.2/0.3.0/0.0.3/0.4.3/8.2.2/5.3.2 1 0 0 28",
+    "0.2.2/0.3.0/0.0.0/0.3.4/9.0.1/0.4.4/0.2.2/0.3.0/0.0.1/0.3.1/4.0.5/2.4.1/0.0.4/0.4.3/11.0.2/6.4.2 1 0 0 48",
+    "0.6.6/0.0.0/0.0.0/0.0.0/9.0.3/0.5.0/0.0.1/0.4.1/0.0.2/0.4.1/0.0.0/3.0.3/1.1.2/1.4.2/12.0.5/6.0.1 1 4 9 68",
+    "0.8.7/0.0.0/1.0.0/0.0.0/10.0.0/0.6.0/0.0.0/0.5.2/1.0.0/0.0.3/0.1.0/0.0.0/1.1.4/1.0.3/12.1.6/0.0.0 1 8 15 88",
+    NULL
+};
+
+static clock_t bench_start;
+static int depth_time_ms[64];
+static uint64_t last_nodes;
+
+static int elapsed_us(clock_t from) {
+    return (int)((clock() - from) * 1000000.0 / CLOCKS_PER_SEC);
+}
+
+// Appelé après chaque itération : on garde le temps pour atteindre la profondeur
+static void record_depth(const SearchInfo* info) {
+    if (info->depth < 64) depth_time_ms[info->depth] = info->time_ms;
+    last_nodes = info->nodes;
+}
+
+// Cumule les compteurs d'une mesure dans un total
+static void perf_accumulate(PerfSample* total, const PerfSample* sample) {
+    for (int i = 0; i < PERF_COUNTERS; i++) {
+        total->value[i] += sample->value[i];
+        total->valid[i] = sample->valid[i];
+    }
+}
+
+// PERFT : nombre de positions à une profondeur donnée (générateur + règles seuls)
+static uint64_t perft(const GameState* game, int depth) {
+    if (depth == 0 || game_over(game)) return 1;
+
+    AIMove moves[64];
+    int n = generate_legal_moves(&game->board, game->current, moves);
+    if (depth == 1) return (uint64_t)n;
+
+    uint64_t leaves = 0;
+    for (int i = 0; i < n; i++) {
+        GameState child = *game;
+        if (apply_move(&child, moves[i])) leaves += perft(&child, depth - 1);
+    }
+    return leaves;
+}
+
+static int run_perft(int depth) {
+    GameState game;
+    game_init(&game);
+    PerfSample sample;
+
+    for (int d = 1; d <= depth; d++) {
+        clock_t start = clock();
+        perf_start();
+        uint64_t leaves = perft(&game, d);
+        perf_stop(&sample);
+        int ms = elapsed_us(start) / 1000;
+        printf("perft %d: %12llu leaves %6d ms\n", d, (unsigned long long)leaves, ms);
+        if (d == depth) perf_print("Perft counters", &sample, leaves);
+    }
+    return 0;
+}
+
+// VÉRIFICATION DES RÈGLES
+// Parties aléatoires jouées en parallèle par game_move() (chemin de l'arbitre, coups texte)
+// et apply_move() (chemin de la recherche). On compare aussi generate_legal_moves()
+// avec valid_move(), et on vérifie que les 96 graines sont conservées.
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+
+static uint64_t rng_next(void) {
+    uint64_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    rng_state = x;
+    return x;
+}
+
+static int check_rules(int games) {
+    int errors = 0;
+    long plies = 0;
+
+    for (int g = 0; g < games && errors < 10; g++) {
+        GameState game;
+        game_init(&game);
+
+        while (!game_over(&game) && errors < 10) {
+            AIMove moves[64];
+            int n = generate_legal_moves(&game.board, game.current, moves);
+
+            // Chaque (trou, couleur) légal doit être généré, et rien d'autre
+            int legal = 0;
+            for (int h = 0; h < N_HOLES; h++) {
+                for (int c = RED; c <= T_AS_BLUE; c++) {
+                    legal += valid_move(&game.board, h, (Color)c, game.current);
+                }
+            }
+            if (legal != n) {
+                printf("Partie %d coup %d : %d coups générés, %d légaux\n", g, game.total_moves, n, legal);
+                errors++;
+            }
+            AIMove side_moves[64];
+            int side_n = (game.current == 1) ? generate_legal_moves_p1(&game.board, side_moves)
+                                             : generate_legal_moves_p2(&game.board, side_moves);
+            if (side_n != n || memcmp(side_moves, moves, sizeof(AIMove) * n) != 0) {
+                printf("Partie %d coup %d : générateur spécialisé différent\n", g, game.total_moves);
+                errors++;
+            }
+            // Expansion groupée : mêmes fils que apply_move
+            SownMove expansion[64];
+            expand_moves(&game.board, moves, n, expansion);
+            for (int i = 0; i < n; i++) {
+                GameState expected = game, expanded = game;
+                apply_move(&expected, moves[i]);
+                game_play_sown(&expanded, &expansion[i]);
+                if (memcmp(&expected, &expanded, sizeof(GameState)) != 0) {
+                    printf("Partie %d coup %d : expansion groupée différente (%d%s)\n", g, game.total_moves,
+                           moves[i].hole, color_to_string(moves[i].color));
+                    errors++;
+                    break;
+                }
+            }
+            if (n == 0) break;
+
+            AIMove move = moves[rng_next() % n];
+            char str[8];
+            snprintf(str, sizeof(str), "%d%s", move.hole, color_to_string(move.color));
+
+            GameState referee = game;
+            GameState search = game;
+            int ok_referee = game_move(&referee, str);
+            int ok_search = apply_move(&search, move);
+            GameState side = game;
+            int ok_side = (game.current == 1) ? apply_move_p1(&side, move) : apply_move_p2(&side, move);
+            if (ok_side != ok_search || memcmp(&side, &search, sizeof(GameState)) != 0) {
+                printf("Partie %d coup %d (%s) : coup spécialisé différent\n", g, game.total_moves, str);
+                errors++;
+            }
+            // Échange statique : le gain annoncé est celui du semis réel (hors famine)
+            Board sown = game.board;
+            int gain, side_gain, sown_gain;
+            sow_and_capture(&sown, move.hole - 1, move.color, &sown_gain, game.current);
+            int net = static_exchange(&game.board, move.hole - 1, move.color, game.current, &gain);
+            int side_net = (game.current == 1) ? static_exchange_p1(&game.board, move.hole - 1, move.color, &side_gain)
+                                               : static_exchange_p2(&game.board, move.hole - 1, move.color, &side_gain);
+            if (gain != sown_gain || net > gain ||
+                side_net != net || side_gain != gain) {
+                printf("Partie %d coup %d (%s) : échange statique faux\n", g, game.total_moves, str);
+                errors++;
+            }
+
+            if (ok_referee != ok_search || memcmp(&referee, &search, sizeof(GameState)) != 0) {
+                printf("Partie %d coup %d (%s) : arbitre et recherche divergent\n", g, game.total_moves, str);
+                errors++;
+            }
+            if (board_total_seeds(&search.board) + search.score[1] + search.score[2] != 96) {
+                printf("Partie %d coup %d (%s) : graines non conservées\n", g, game.total_moves, str);
+                errors++;
+            }
+            game = search;
+            plies++;
+        }
+    }
+
+    printf("Rules: %d games, %ld plies, %d errors\n", games, plies, errors);
+    return errors ? 1 : 0;
+}
+
+// NOYAUX PAR CAMP
+// Les positions de test cherchées avec les noyaux génériques puis spécialisés :
+// l'arbre doit être identique (mêmes noeuds), seuls le temps et les branchements changent
+
+static int run_side_compare(int depth, bool counters) {
+    const char* labels[2] = {"generic", "specialized"};
+    uint64_t nodes[2] = {0, 0};
+    int ms[2] = {0, 0};
+    PerfSample totals[2] = {{{0}, {false}}, {{0}, {false}}};
+
+    for (int v = 0; v < 2; v++) {
+        ai_set_side_specialization(v == 1);
+        for (int p = 0; bench_positions[p]; p++) {
+            GameState game;
+            AIMove move;
+            game_from_string(&game, bench_positions[p]);
+            tt_clear();
+            AI_Advanced.new_game();
+
+            SearchLimits limits = {0};
+            limits.depth = depth;
+            limits.report = record_depth;
+            last_nodes = 0;
+
+            PerfSample sample;
+            clock_t start = clock();
+            perf_start();
+            AI_Advanced.search(&game, &limits, &move);
+            perf_stop(&sample);
+            ms[v] += elapsed_us(start) / 1000;
+            perf_accumulate(&totals[v], &sample);
+            nodes[v] += last_nodes;
+        }
+        printf("%-12s %10llu nodes %6d ms %9llu nps\n", labels[v], (unsigned long long)nodes[v], ms[v],
+               (unsigned long long)(ms[v] > 0 ? nodes[v] * 1000 / ms[v] : 0));
+        if (counters) perf_print(labels[v], &totals[v], nodes[v]);
+    }
+    ai_set_side_specialization(true);
+
+    if (nodes[0] != nodes[1]) {
+        printf("Erreur : les deux variantes ne cherchent pas le même arbre\n");
+        return 1;
+    }
+    if (ms[0] > 0) printf("Speedup: %.2fx\n", (double)ms[0] / (ms[1] > 0 ? ms[1] : 1));
+    return 0;
+}
+
+// SOLVEUR DE FIN DE PARTIE
+// Fins de partie tirées de parties aléatoires (dès que le solveur se déclencherait) :
+// le solveur seul, puis la recherche à profondeur fixe sans solveur. Une victoire prouvée
+// que la recherche voit perdue est une erreur
+
+static int run_solve(int positions) {
+    int proven = 0, no_win = 0, unknown = 0, errors = 0, search_wins = 0;
+    uint64_t solver_nodes = 0;
+    int solver_ms = 0, search_ms = 0;
+    int slice = pn_config.slice_percent;
+
+    for (int p = 0; p < positions; p++) {
+        GameState game;
+        game_init(&game);
+        while (!game_over(&game) && !pn_should_solve(&game)) {
+            AIMove moves[64];
+            int n = generate_legal_moves(&game.board, game.current, moves);
+            if (n == 0) break;
+            apply_move(&game, moves[rng_next() % n]);
+        }
+        if (game_over(&game) || !pn_should_solve(&game)) {
+            p--;
+            continue;
+        }
+
+        AIMove move;
+        uint64_t nodes;
+        clock_t start = clock();
+        PnResult result = pn_solve(&game, pn_config.max_nodes, 0, NULL, &move, &nodes);
+        solver_ms += elapsed_us(start) / 1000;
+        solver_nodes += nodes;
+        if (result != PN_WIN) {
+            if (result == PN_NO_WIN) no_win++;
+            else unknown++;
+            continue;
+        }
+        proven++;
+
+        pn_config.slice_percent = 0;
+        tt_clear();
+        AI_Advanced.new_game();
+        SearchLimits limits = {0};
+        limits.depth = SOLVE_SEARCH_DEPTH;
+        AIMove search_move;
+        start = clock();
+        int score = AI_Advanced.search(&game, &limits, &search_move);
+        search_ms += elapsed_us(start) / 1000;
+        pn_config.slice_percent = slice;
+
+        if (score > WIN_SCORE_BENCH - 100) search_wins++;
+        if (score < -WIN_SCORE_BENCH + 100) {
+            printf("Erreur : victoire prouvée, recherche perdante (coup %d)\n", game.total_moves);
+            errors++;
+        }
+    }
+
+    printf("Solver: %d positions, %d proven wins, %d no win, %d unknown\n", positions, proven, no_win,
+           unknown);
+    printf("Solver: %llu nodes, %d ms, %llu nps\n", (unsigned long long)solver_nodes, solver_ms,
+           (unsigned long long)(solver_ms > 0 ? solver_nodes * 1000 / solver_ms : 0));
+    printf("Depth %d search on proven wins: %d/%d seen as wins, %d ms\n", SOLVE_SEARCH_DEPTH, search_wins,
+           proven, search_ms);
+    return errors ? 1 : 0;
+}
+
+// POSITIONS ALÉATOIRES
+// Les six positions de test ne suffisent pas à juger un changement de tri : le nombre de
+// noeuds d'un arbre varie de +/-10 % au moindre changement. On cherche ici des positions
+// tirées de parties aléatoires (4 à 43 demi-coups), table et heuristiques vidées à chaque fois.
+
+static int run_random(int positions, int depth) {
+    uint64_t total_nodes = 0, cutoffs = 0, first_cutoffs = 0;
+    int sum_depth_ms[64] = {0};
+    clock_t start = clock();
+
+    for (int p = 0; p < positions;) {
+        GameState game;
+        game_init(&game);
+        AIMove moves[64];
+        int plies = RANDOM_MIN_PLIES + (int)(rng_next() % (RANDOM_MAX_PLIES - RANDOM_MIN_PLIES + 1));
+        for (int i = 0; i < plies && !game_over(&game); i++) {
+            int n = generate_legal_moves(&game.board, game.current, moves);
+            if (n == 0) break;
+            apply_move(&game, moves[rng_next() % n]);
+        }
+        if (game_over(&game)) continue;
+
+        tt_clear();
+        AI_Advanced.new_game();
+        for (int d = 0; d < 64; d++) depth_time_ms[d] = -1;
+        SearchLimits limits = {0};
+        limits.depth = depth;
+        limits.report = record_depth;
+        last_nodes = 0;
+        AIMove move;
+        AI_Advanced.search(&game, &limits, &move);
+        total_nodes += last_nodes;
+        for (int d = 1; d <= depth && d < 64; d++) {
+            if (depth_time_ms[d] >= 0) sum_depth_ms[d] += depth_time_ms[d];
+        }
+        uint64_t c[64], f[64];
+        ai_get_cutoff_stats(c, f, 63);
+        for (int d = 1; d < 64; d++) {
+            cutoffs += c[d];
+            first_cutoffs += f[d];
+        }
+        p++;
+    }
+
+    int ms = elapsed_us(start) / 1000;
+    printf("Time to depth (sum over positions):\n");
+    for (int d = 1; d <= depth && d < 64; d++) {
+        printf("  depth %2d: %6d ms\n", d, sum_depth_ms[d]);
+    }
+    printf("Random: %d positions, depth %d, %llu nodes, %d ms, first-move cutoffs %.1f%%\n", positions, depth,
+           (unsigned long long)total_nodes, ms, cutoffs ? 100.0 * (double)first_cutoffs / (double)cutoffs : 0.0);
+    return 0;
+}
+
+// MATCH À TEMPS FIXE
+// Élagage sélectif (marges courantes) contre le même moteur sans élagage sélectif.
+// Chaque ouverture tirée au hasard est jouée deux fois, couleurs inversées ; table et
+// heuristiques sont remises à zéro avant chaque coup pour que les deux camps partent égaux.
+
+// Écart Elo correspondant à un score (borné pour rester fini à 0 % et 100 %)
+static double match_elo(double score) {
+    if (score < 0.001) score = 0.001;
+    if (score > 0.999) score = 0.999;
+    return -400.0 * log10(1.0 / score - 1.0);
+}
+
+static int run_match(int games, int movetime_ms) {
+    PruneConfig pruned = prune_config, plain = prune_config;
+    plain.futility_margin = plain.razor_margin = plain.probcut_margin = 0;
+    int wins = 0, draws = 0, losses = 0;
+    GameState opening;
+
+    for (int g = 0; g < games; g++) {
+        AIMove moves[64];
+        if (g % 2 == 0) {
+            game_init(&opening);
+            for (int i = 0; i < MATCH_RANDOM_PLIES; i++) {
+                int n = generate_legal_moves(&opening.board, opening.current, moves);
+                if (n == 0) break;
+                apply_move(&opening, moves[rng_next() % n]);
+            }
+        }
+        GameState game = opening;
+        int pruned_side = (g % 2 == 0) ? 1 : 2;
+
+        while (!game_over(&game)) {
+            int n = generate_legal_moves(&game.board, game.current, moves);
+            if (n == 0) break;
+            prune_config = (game.current == pruned_side) ? pruned : plain;
+            tt_clear();
+            AI_Advanced.new_game();
+            SearchLimits limits = {0};
+            limits.movetime_ms = movetime_ms;
+            AIMove best = moves[0];
+            AI_Advanced.search(&game, &limits, &best);
+            if (best.hole == 0) break;
+            apply_move(&game, best);
+        }
+
+        int winner = get_game_result(&game);
+        if (winner == 0) draws++;
+        else if (winner == pruned_side) wins++;
+        else losses++;
+    }
+    prune_config = pruned;
+
+    double score = (wins + draws / 2.0) / games;
+    // Intervalle à 95 % : écart type du score par partie, ramené en Elo aux deux bornes
+    double variance = (wins * (1 - score) * (1 - score) + draws * (0.5 - score) * (0.5 - score) +
+                       losses * score * score) / games;
+    double margin = 1.96 * sqrt(variance / games);
+    double elo = match_elo(score);
+    double error = (match_elo(score + margin) - match_elo(score - margin)) / 2;
+    printf("Match: %d games, %d ms/move, pruning +%d =%d -%d, score %.1f%%, elo %+.0f +/- %.0f (95%%)\n",
+           games, movetime_ms, wins, draws, losses, 100.0 * score, elo, error);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    // Options en tête, avant le mode
+    while (argc > 2 && strncmp(argv[1], "--", 2) == 0) {
+        if (strcmp(argv[1], "--eval-params") == 0 && !eval_params_load(argv[2])) {
+            fprintf(stderr, "Poids illisibles: %s\n", argv[2]);
+            return 1;
+        }
+        if (strcmp(argv[1], "--futility") == 0) prune_config.futility_margin = atoi(argv[2]);
+        if (strcmp(argv[1], "--razoring") == 0) prune_config.razor_margin = atoi(argv[2]);
+        if (strcmp(argv[1], "--probcut") == 0) prune_config.probcut_margin = atoi(argv[2]);
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc > 1 && strcmp(argv[1], "rules") == 0) {
+        return check_rules((argc > 2) ? atoi(argv[2]) : 10000);
+    }
+    bool counters = perf_init();
+    if (!counters) printf("Hardware counters unavailable, timing only\n");
+    if (argc > 1 && strcmp(argv[1], "perft") == 0) {
+        int depth = (argc > 2) ? atoi(argv[2]) : PERFT_DEFAULT_DEPTH;
+        int ret = run_perft(depth > 0 ? depth : PERFT_DEFAULT_DEPTH);
+        perf_close();
+        return ret;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "side") == 0) {
+        int depth = (argc > 2) ? atoi(argv[2]) : BENCH_DEFAULT_DEPTH;
+        tt_init();
+        AI_Advanced.init();
+        int ret = run_side_compare(depth > 0 ? depth : BENCH_DEFAULT_DEPTH, counters);
+        perf_close();
+        tt_cleanup();
+        return ret;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "solve") == 0) {
+        int positions = (argc > 2) ? atoi(argv[2]) : 50;
+        tt_init();
+        AI_Advanced.init();
+        int ret = run_solve(positions > 0 ? positions : 50);
+        perf_close();
+        tt_cleanup();
+        return ret;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "random") == 0) {
+        int positions = (argc > 2) ? atoi(argv[2]) : 200;
+        int depth = (argc > 3) ? atoi(argv[3]) : BENCH_DEFAULT_DEPTH;
+        tt_init();
+        AI_Advanced.init();
+        int ret = run_random(positions > 0 ? positions : 200, depth > 0 ? depth : BENCH_DEFAULT_DEPTH);
+        perf_close();
+        tt_cleanup();
+        return ret;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "match") == 0) {
+        int games = (argc > 2) ? atoi(argv[2]) : 20;
+        int movetime_ms = (argc > 3) ? atoi(argv[3]) : 100;
+        tt_init();
+        AI_Advanced.init();
+        int ret = run_match(games > 0 ? games : 20, movetime_ms > 0 ? movetime_ms : 100);
+        perf_close();
+        tt_cleanup();
+        return ret;
+    }
+
+    int depth = (argc > 1) ? atoi(argv[1]) : BENCH_DEFAULT_DEPTH;
+    if (depth <= 0) depth = BENCH_DEFAULT_DEPTH;
+
+    // 1. Démarrage : initialisation + premier coup (profondeur 1)
+    clock_t t0 = clock();
+    tt_init();
+    AI_Advanced.init();
+    int init_us = elapsed_us(t0);
+
+    GameState game;
+    game_init(&game);
+    SearchLimits first = {0};
+    first.depth = 1;
+    AIMove move;
+    AI_Advanced.search(&game, &first, &move);
+    printf("Startup: init %d us, time to first move %d us\n", init_us, elapsed_us(t0));
+
+    // 2. Série de positions à profondeur fixe (table vidée entre chaque position)
+    uint64_t total_nodes = 0;
+    int total_ms = 0;
+    int sum_depth_ms[64] = {0};
+    uint64_t sum_cutoffs[64] = {0}, sum_first_cutoffs[64] = {0};
+    uint64_t tt_hits = 0, tt_misses = 0;
+    PerfSample search_counters = {{0}, {false}};
+    PerfSample sample;
+
+    for (int p = 0; bench_positions[p]; p++) {
+        if (!game_from_string(&game, bench_positions[p])) {
+            fprintf(stderr, "Position %d invalide\n", p + 1);
+            return 1;
+        }
+        tt_clear();
+        AI_Advanced.new_game();
+        for (int d = 0; d < 64; d++) depth_time_ms[d] = -1;
+
+        SearchLimits limits = {0};
+        limits.depth = depth;
+        limits.report = record_depth;
+
+        last_nodes = 0;
+        bench_start = clock();
+        perf_start();
+        AI_Advanced.search(&game, &limits, &move);
+        perf_stop(&sample);
+        int ms = elapsed_us(bench_start) / 1000;
+        perf_accumulate(&search_counters, &sample);
+        uint64_t hits, misses, collisions;
+        tt_get_stats(&hits, &misses, &collisions);
+        tt_hits += hits;
+        tt_misses += misses;
+        uint64_t nodes = last_nodes;
+        uint64_t cutoffs[64], first_cutoffs[64];
+        ai_get_cutoff_stats(cutoffs, first_cutoffs, 63);
+        for (int d = 0; d < 64; d++) {
+            sum_cutoffs[d] += cutoffs[d];
+            sum_first_cutoffs[d] += first_cutoffs[d];
+        }
+
+        printf("Position %2d: %9llu nodes %6d ms  best %d%s\n", p + 1,
+               (unsigned long long)nodes, ms, move.hole, color_to_string(move.color));
+        total_nodes += nodes;
+        total_ms += ms;
+        for (int d = 1; d <= depth && d < 64; d++) {
+            if (depth_time_ms[d] >= 0) sum_depth_ms[d] += depth_time_ms[d];
+        }
+    }
+
+    printf("\nTime to depth (sum over positions):\n");
+    for (int d = 1; d <= depth && d < 64; d++) {
+        printf("  depth %2d: %6d ms\n", d, sum_depth_ms[d]);
+    }
+    // Qualité du tri : part des coupures beta obtenues par le premier coup essayé
+    printf("\nFirst-move cutoffs by remaining depth (sum over positions):\n");
+    for (int d = 1; d < 64; d++) {
+        if (sum_cutoffs[d] == 0) continue;
+        printf("  depth %2d: %5.1f%% of %llu\n", d, 100.0 * (double)sum_first_cutoffs[d] / (double)sum_cutoffs[d],
+               (unsigned long long)sum_cutoffs[d]);
+    }
+    printf("\nTotal: %llu nodes, %d ms, %llu nps\n", (unsigned long long)total_nodes, total_ms,
+           (unsigned long long)(total_ms > 0 ? total_nodes * 1000 / total_ms : 0));
+    printf("TT: %llu hits / %llu probes (%.2f%%)\n", (unsigned long long)tt_hits,
+           (unsigned long long)(tt_hits + tt_misses),
+           (tt_hits + tt_misses) ? 100.0 * (double)tt_hits / (double)(tt_hits + tt_misses) : 0.0);
+    if (counters) perf_print("Search counters", &search_counters, total_nodes);
+    AI_Advanced.print_stats();
+
+    // 3. Séquence de coups consécutifs depuis le départ, sans rien vider entre les coups
+    // (mesure ce qu'on gagne à réutiliser TT, killers et historique d'un coup à l'autre)
+    game_init(&game);
+    tt_clear();
+    AI_Advanced.new_game();
+    uint64_t seq_nodes = 0;
+    clock_t seq_start = clock();
+    PerfSample seq_counters = {{0}, {false}};
+    int plies = 0;
+    for (; plies < BENCH_SEQUENCE_PLIES && !game_over(&game); plies++) {
+        SearchLimits limits = {0};
+        limits.depth = depth;
+        limits.report = record_depth;
+        last_nodes = 0;
+        perf_start();
+        AI_Advanced.search(&game, &limits, &move);
+        perf_stop(&sample);
+        perf_accumulate(&seq_counters, &sample);
+        if (move.hole == 0 || !apply_move(&game, move)) break;
+        seq_nodes += last_nodes;
+    }
+    int seq_ms = elapsed_us(seq_start) / 1000;
+    printf("Sequence: %d plies, %llu nodes, %d ms\n", plies, (unsigned long long)seq_nodes, seq_ms);
+    if (counters) perf_print("Sequence counters", &seq_counters, seq_nodes);
+
+    perf_close();
+
+    AI_Advanced.cleanup();
+    tt_cleanup();
+    return 0;
+}
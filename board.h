@@ -3,6 +3,10 @@
 
 #define N_HOLES 16
 
+// Corps de fonction recopié dans chaque appelant : sert à compiler les noyaux
+// en deux variantes (joueur 1 / joueur 2) où le camp au trait est une constante
+#define FORCE_INLINE inline __attribute__((always_inline))
+
 typedef struct {
     int red;
     int blue;
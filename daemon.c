@@ -0,0 +1,600 @@
+// Démon d'analyse sur socket Unix
+// Garde un pool de moteurs chauds (un processus par moteur : l'IA Advanced garde son état
+// dans des globales) et répond à des requêtes JSON, une par ligne, venues de plusieurs
+// clients à la fois. Les requêtes vont dans une file commune ; un thread par moteur
+// la vide et renvoie au client les lignes du moteur au fur et à mesure.
+//
+// Usage : awale_daemon.exe [--socket chemin] [--workers N] [--tt-shared nom]
+//                              [--eval-params fichier] [--futility|--razoring|--probcut marge]
+//
+// Requête  : {"id": 1, "position": "startpos", "moves": "1R 2TB", "depth": 10,
+//             "movetime": 500, "nodes": 0, "multipv": 3}
+//            (position : "startpos" ou la notation de game_from_string, limites par ligne du multipv,
+//             sans limite : movetime 1000 ; au plus 4095 octets, sinon erreur "requete trop longue")
+// Réponses : {"id":1,"type":"info","multipv":1,"depth":5,"score":120,"nodes":4242,"time":3,"pv":"3R"}
+//            {"id":1,"type":"bestmove","move":"3R","score":120,"time":..,"worker":0,
+//             "multipv":[{"move":"3R","score":120},...]}
+//            {"id":1,"type":"error","message":"..."}
+#define _POSIX_C_SOURCE 200809L
+#include "ai.h"
+#include "ai_advanced.h"
+#include "ai_interface.h"
+#include "eval_params.h"
+#include "game.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+
+int main(void) {
+    fprintf(stderr, "awale_daemon : sockets Unix non disponibles sous Windows\n");
+    return 1;
+}
+
+#else
+
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DEFAULT_SOCKET "/tmp/awale.sock"
+#define DEFAULT_WORKERS 2
+#define MAX_WORKERS 64
+#define MAX_LINE 4096
+#define MAX_MULTIPV 16
+#define DEFAULT_MOVETIME_MS 1000
+
+
+// OUTILS
+
+
+static uint64_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+static bool write_all(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        ssize_t w = write(fd, data, len);
+        if (w <= 0) return false;
+        data += w;
+        len -= (size_t)w;
+    }
+    return true;
+}
+
+// Lecture ligne par ligne sur un descripteur (tampon propre à chaque lecteur)
+typedef struct {
+    int fd;
+    char buf[MAX_LINE];
+    size_t len;
+    bool skip;      // Fin d'une ligne trop longue à jeter jusqu'au prochain '\n'
+} LineReader;
+
+#define LINE_TOO_LONG (-2)
+
+// Renvoie la longueur de la ligne (sans '\n'), -1 en fin de flux.
+// Une ligne de MAX_LINE octets ou plus est jetée jusqu'à son '\n' : LINE_TOO_LONG,
+// line garde son début (pour l'identifiant de la requête)
+static int read_line(LineReader* r, char* line) {
+    for (;;) {
+        char* nl = memchr(r->buf, '\n', r->len);
+        if (r->skip) {
+            size_t used = nl ? (size_t)(nl - r->buf) + 1 : r->len;
+            memmove(r->buf, r->buf + used, r->len - used);
+            r->len -= used;
+            if (nl) {
+                r->skip = false;
+                return LINE_TOO_LONG;
+            }
+        } else if (nl) {
+            size_t n = (size_t)(nl - r->buf);
+            memcpy(line, r->buf, n);
+            line[n] = '\0';
+            memmove(r->buf, r->buf + n + 1, r->len - n - 1);
+            r->len -= n + 1;
+            return (int)n;
+        } else if (r->len == sizeof(r->buf)) {
+            memcpy(line, r->buf, MAX_LINE - 1);
+            line[MAX_LINE - 1] = '\0';
+            r->len = 0;
+            r->skip = true;
+            continue;
+        }
+        ssize_t got = read(r->fd, r->buf + r->len, sizeof(r->buf) - r->len);
+        if (got <= 0) return -1;
+        r->len += (size_t)got;
+    }
+}
+
+
+// JSON MINIMAL
+// Les requêtes sont des objets plats : on cherche "clé" puis sa valeur
+
+
+static const char* json_value(const char* json, const char* key) {
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\"", key);
+    const char* p = strstr(json, pattern);
+    if (!p) return NULL;
+    p += strlen(pattern);
+    while (*p == ' ' || *p == '\t') p++;
+    if (*p != ':') return NULL;
+    p++;
+    while (*p == ' ' || *p == '\t') p++;
+    return p;
+}
+
+static long json_int(const char* json, const char* key, long fallback) {
+    const char* v = json_value(json, key);
+    return v ? strtol(v, NULL, 10) : fallback;
+}
+
+// Quatre chiffres hexadécimaux de \uXXXX, -1 sinon
+static int json_hex4(const char* v) {
+    int code = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = v[i];
+        int d = (c >= '0' && c <= '9') ? c - '0'
+                : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+                : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+        if (d < 0) return -1;
+        code = code * 16 + d;
+    }
+    return code;
+}
+
+// Chaîne JSON décodée (échappements compris, \uXXXX en UTF-8) ; v pointe sur le '"' ouvrant.
+// false si la chaîne est mal formée ou plus longue que out
+static bool json_unescape(const char* v, char* out, size_t size) {
+    size_t n = 0;
+    for (v++; *v != '"'; v++) {
+        if (*v == '\0') return false;
+        char bytes[4];
+        int len = 1;
+        bytes[0] = *v;
+        if (*v == '\\') {
+            v++;
+            switch (*v) {
+                case '"': case '\\': case '/': bytes[0] = *v; break;
+                case 'b': bytes[0] = '\b'; break;
+                case 'f': bytes[0] = '\f'; break;
+                case 'n': bytes[0] = '\n'; break;
+                case 'r': bytes[0] = '\r'; break;
+                case 't': bytes[0] = '\t'; break;
+                case 'u': {
+                    long c = json_hex4(v + 1);
+                    if (c < 0) return false;
+                    v += 4;
+                    // Paire de substitution : \uD8xx\uDCxx
+                    if (c >= 0xD800 && c < 0xDC00 && v[1] == '\\' && v[2] == 'u') {
+                        long low = json_hex4(v + 3);
+                        if (low >= 0xDC00 && low < 0xE000) {
+                            c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                            v += 6;
+                        }
+                    }
+                    if (c < 0x80) {
+                        bytes[0] = (char)c;
+                    } else if (c < 0x800) {
+                        bytes[0] = (char)(0xC0 | (c >> 6));
+                        bytes[1] = (char)(0x80 | (c & 0x3F));
+                        len = 2;
+                    } else if (c < 0x10000) {
+                        bytes[0] = (char)(0xE0 | (c >> 12));
+                        bytes[1] = (char)(0x80 | ((c >> 6) & 0x3F));
+                        bytes[2] = (char)(0x80 | (c & 0x3F));
+                        len = 3;
+                    } else {
+                        bytes[0] = (char)(0xF0 | (c >> 18));
+                        bytes[1] = (char)(0x80 | ((c >> 12) & 0x3F));
+                        bytes[2] = (char)(0x80 | ((c >> 6) & 0x3F));
+                        bytes[3] = (char)(0x80 | (c & 0x3F));
+                        len = 4;
+                    }
+                    break;
+                }
+                default: return false;
+            }
+        }
+        if (n + (size_t)len + 1 > size) return false;
+        memcpy(out + n, bytes, (size_t)len);
+        n += (size_t)len;
+    }
+    out[n] = '\0';
+    return true;
+}
+
+static bool json_string(const char* json, const char* key, char* out, size_t size) {
+    const char* v = json_value(json, key);
+    return v && *v == '"' && json_unescape(v, out, size);
+}
+
+// Identifiant renvoyé dans les réponses (nombre recopié, chaîne décodée puis réécrite
+// échappée), "null" s'il manque ou ne tient pas dans out
+static void json_id(const char* json, char* out, size_t size) {
+    const char* v = json_value(json, "id");
+    size_t n = 0;
+    if (v && *v == '"') {
+        char raw[128];
+        if (json_unescape(v, raw, sizeof(raw))) {
+            out[n++] = '"';
+            for (const char* p = raw; *p && n < size; p++) {
+                unsigned char c = (unsigned char)*p;
+                char esc[8];
+                int len;
+                if (c == '"' || c == '\\') len = snprintf(esc, sizeof(esc), "\\%c", c);
+                else if (c < 0x20) len = snprintf(esc, sizeof(esc), "\\u%04x", c);
+                else len = snprintf(esc, sizeof(esc), "%c", c);
+                if (n + (size_t)len + 2 > size) {
+                    n = 0;
+                    break;
+                }
+                memcpy(out + n, esc, (size_t)len);
+                n += (size_t)len;
+            }
+            if (n > 0) out[n++] = '"';
+        }
+    } else if (v) {
+        while (*v && *v != ',' && *v != '}' && *v != ' ' && n + 1 < size) out[n++] = *v++;
+    }
+    if (n == 0) {
+        snprintf(out, size, "null");
+        return;
+    }
+    out[n] = '\0';
+}
+
+
+// MOTEUR (processus fils)
+// Lit une requête par ligne sur son socket, répond par des lignes "info" puis une ligne finale
+
+
+static FILE* worker_out;
+static char worker_id[128];
+static int worker_pv;
+static int worker_index;
+
+static void worker_report(const SearchInfo* info) {
+    fprintf(worker_out,
+            "{\"id\":%s,\"type\":\"info\",\"multipv\":%d,\"depth\":%d,\"score\":%d,\"nodes\":%llu,"
+            "\"time\":%d,\"pv\":\"%d%s\"}\n",
+            worker_id, worker_pv, info->depth, info->score, (unsigned long long)info->nodes,
+            info->time_ms, info->best_move.hole, color_to_string(info->best_move.color));
+    fflush(worker_out);
+}
+
+static void worker_error(const char* message) {
+    fprintf(worker_out, "{\"id\":%s,\"type\":\"error\",\"message\":\"%s\"}\n", worker_id, message);
+    fflush(worker_out);
+}
+
+static void worker_handle(char* request) {
+    json_id(request, worker_id, sizeof(worker_id));
+
+    // Position
+    char position[MAX_LINE], moves[MAX_LINE];
+    GameState game;
+    if (!json_string(request, "position", position, sizeof(position)) || strcmp(position, "startpos") == 0) {
+        game_init(&game);
+    } else if (!game_from_string(&game, position)) {
+        worker_error("position invalide");
+        return;
+    }
+    if (json_string(request, "moves", moves, sizeof(moves))) {
+        for (char* tok = strtok(moves, " "); tok; tok = strtok(NULL, " ")) {
+            if (!game_move(&game, tok)) {
+                worker_error("coup invalide");
+                return;
+            }
+        }
+    }
+
+    AIMove legal[64];
+    int n = generate_legal_moves(&game.board, game.current, legal);
+    if (n == 0 || game_over(&game)) {
+        worker_error("partie terminee");
+        return;
+    }
+
+    // Limites (pour chaque ligne du multipv)
+    SearchLimits limits = {0};
+    limits.depth = (int)json_int(request, "depth", 0);
+    limits.movetime_ms = (int)json_int(request, "movetime", 0);
+    limits.nodes = (uint64_t)json_int(request, "nodes", 0);
+    limits.report = worker_report;
+    if (limits.depth <= 0 && limits.movetime_ms <= 0 && limits.nodes == 0) {
+        limits.movetime_ms = DEFAULT_MOVETIME_MS;
+    }
+    int multipv = (int)json_int(request, "multipv", 1);
+    if (multipv < 1) multipv = 1;
+    if (multipv > MAX_MULTIPV) multipv = MAX_MULTIPV;
+    if (multipv > n) multipv = n;
+
+    // Ligne k : recherche sans les k-1 meilleurs coups déjà trouvés
+    AIMove found[MAX_MULTIPV];
+    int scores[MAX_MULTIPV];
+    uint64_t start = now_ms();
+    for (int k = 0; k < multipv; k++) {
+        worker_pv = k + 1;
+        limits.exclude = found;
+        limits.n_exclude = k;
+        scores[k] = AI_Advanced.search(&game, &limits, &found[k]);
+        if (found[k].hole == 0) {
+            multipv = k;
+            break;
+        }
+    }
+    if (multipv == 0) {
+        worker_error("aucun coup");
+        return;
+    }
+
+    char lines[MAX_MULTIPV * 48];
+    size_t len = 0;
+    for (int k = 0; k < multipv; k++) {
+        len += (size_t)snprintf(lines + len, sizeof(lines) - len, "%s{\"move\":\"%d%s\",\"score\":%d}",
+                                k ? "," : "", found[k].hole, color_to_string(found[k].color), scores[k]);
+    }
+    fprintf(worker_out,
+            "{\"id\":%s,\"type\":\"bestmove\",\"move\":\"%d%s\",\"score\":%d,\"time\":%llu,\"worker\":%d,"
+            "\"multipv\":[%s]}\n",
+            worker_id, found[0].hole, color_to_string(found[0].color), scores[0],
+            (unsigned long long)(now_ms() - start), worker_index, lines);
+    fflush(worker_out);
+}
+
+static void worker_main(int fd, int index, const char* tt_shared) {
+    tt_init();
+    if (tt_shared && !tt_open_shared(tt_shared)) {
+        fprintf(stderr, "Moteur %d : TT partagee indisponible (%s)\n", index, tt_shared);
+    }
+    AI_Advanced.init();
+    worker_index = index;
+    worker_out = fdopen(dup(fd), "w");
+
+    LineReader reader = {fd, {0}, 0, false};
+    char line[MAX_LINE];
+    int len;
+    while ((len = read_line(&reader, line)) != -1) {
+        if (len >= 0) worker_handle(line);
+    }
+    fclose(worker_out);
+    AI_Advanced.cleanup();
+    tt_cleanup();
+    _exit(0);
+}
+
+
+// CLIENTS ET FILE DE REQUÊTES
+
+
+typedef struct {
+    int fd;
+    int refs;                  // Lecteur + requêtes en attente ou en cours
+    pthread_mutex_t write_lock; // Les réponses de plusieurs moteurs ne doivent pas s'entremêler
+} Client;
+
+typedef struct Job {
+    Client* client;
+    char* line;
+    struct Job* next;
+} Job;
+
+static struct {
+    Job* head;
+    Job* tail;
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+} queue = {NULL, NULL, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER};
+
+static pthread_mutex_t clients_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void client_release(Client* c) {
+    pthread_mutex_lock(&clients_lock);
+    bool last = (--c->refs == 0);
+    pthread_mutex_unlock(&clients_lock);
+    if (last) {
+        close(c->fd);
+        pthread_mutex_destroy(&c->write_lock);
+        free(c);
+    }
+}
+
+static void client_send(Client* c, const char* line) {
+    pthread_mutex_lock(&c->write_lock);
+    size_t len = strlen(line);
+    // Client parti : la réponse est perdue, la requête se termine quand même
+    if (write_all(c->fd, line, len)) write_all(c->fd, "\n", 1);
+    pthread_mutex_unlock(&c->write_lock);
+}
+
+static void queue_push(Client* c, const char* line) {
+    Job* job = malloc(sizeof(Job));
+    job->client = c;
+    job->line = strdup(line);
+    job->next = NULL;
+    pthread_mutex_lock(&clients_lock);
+    c->refs++;
+    pthread_mutex_unlock(&clients_lock);
+
+    pthread_mutex_lock(&queue.lock);
+    if (queue.tail) queue.tail->next = job;
+    else queue.head = job;
+    queue.tail = job;
+    pthread_cond_signal(&queue.ready);
+    pthread_mutex_unlock(&queue.lock);
+}
+
+static Job* queue_pop(void) {
+    pthread_mutex_lock(&queue.lock);
+    while (!queue.head) pthread_cond_wait(&queue.ready, &queue.lock);
+    Job* job = queue.head;
+    queue.head = job->next;
+    if (!queue.head) queue.tail = NULL;
+    pthread_mutex_unlock(&queue.lock);
+    return job;
+}
+
+// Un thread par client : chaque ligne non vide devient une requête
+// (une ligne trop longue reçoit une erreur, rien de son contenu n'est exécuté)
+static void* client_thread(void* arg) {
+    Client* c = arg;
+    LineReader reader = {c->fd, {0}, 0, false};
+    char line[MAX_LINE];
+    int len;
+    while ((len = read_line(&reader, line)) != -1) {
+        if (len == LINE_TOO_LONG) {
+            char id[128], error[192];
+            json_id(line, id, sizeof(id));
+            snprintf(error, sizeof(error), "{\"id\":%s,\"type\":\"error\",\"message\":\"requete trop longue\"}", id);
+            client_send(c, error);
+        } else if (len > 0) {
+            queue_push(c, line);
+        }
+    }
+    shutdown(c->fd, SHUT_RD);
+    client_release(c);
+    return NULL;
+}
+
+
+// RÉPARTITION SUR LES MOTEURS
+// Un thread par moteur : prend la requête suivante, la transmet au moteur et relaie ses
+// lignes au client jusqu'à la ligne finale (bestmove ou error)
+
+
+typedef struct {
+    int index;
+    int fd;
+    LineReader reader;
+} Worker;
+
+static void* dispatch_thread(void* arg) {
+    Worker* w = arg;
+    char line[MAX_LINE];
+    for (;;) {
+        Job* job = queue_pop();
+        bool alive = write_all(w->fd, job->line, strlen(job->line)) && write_all(w->fd, "\n", 1);
+        while (alive) {
+            int len = read_line(&w->reader, line);
+            if (len == LINE_TOO_LONG) continue;
+            if (len < 0) {
+                alive = false;
+                break;
+            }
+            client_send(job->client, line);
+            if (strstr(line, "\"type\":\"bestmove\"") || strstr(line, "\"type\":\"error\"")) break;
+        }
+        if (!alive) {
+            char id[128], error[192];
+            json_id(job->line, id, sizeof(id));
+            snprintf(error, sizeof(error), "{\"id\":%s,\"type\":\"error\",\"message\":\"moteur %d arrete\"}",
+                     id, w->index);
+            client_send(job->client, error);
+        }
+        client_release(job->client);
+        free(job->line);
+        free(job);
+        if (!alive) {
+            fprintf(stderr, "Moteur %d arrete\n", w->index);
+            return NULL;
+        }
+    }
+}
+
+
+// MAIN
+
+
+int main(int argc, char** argv) {
+    const char* socket_path = DEFAULT_SOCKET;
+    const char* tt_shared = NULL;
+    int n_workers = DEFAULT_WORKERS;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc) socket_path = argv[++i];
+        else if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc) n_workers = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--tt-shared") == 0 && i + 1 < argc) tt_shared = argv[++i];
+        else if (strcmp(argv[i], "--eval-params") == 0 && i + 1 < argc && !eval_params_load(argv[++i]))
+            fprintf(stderr, "Poids illisibles: %s\n", argv[i]);
+        else if (strcmp(argv[i], "--futility") == 0 && i + 1 < argc) prune_config.futility_margin = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--razoring") == 0 && i + 1 < argc) prune_config.razor_margin = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--probcut") == 0 && i + 1 < argc) prune_config.probcut_margin = atoi(argv[++i]);
+    }
+    if (n_workers < 1) n_workers = 1;
+    if (n_workers > MAX_WORKERS) n_workers = MAX_WORKERS;
+
+    // Client parti : write() doit échouer, pas tuer le démon
+    signal(SIGPIPE, SIG_IGN);
+
+    // Les moteurs sont créés avant tout thread (fork d'un processus à un seul thread)
+    static Worker workers[MAX_WORKERS];
+    for (int i = 0; i < n_workers; i++) {
+        int pair[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair) != 0) {
+            perror("socketpair");
+            return 1;
+        }
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            return 1;
+        }
+        if (pid == 0) {
+            close(pair[0]);
+            for (int j = 0; j < i; j++) close(workers[j].fd);
+            worker_main(pair[1], i, tt_shared);
+        }
+        close(pair[1]);
+        workers[i].index = i;
+        workers[i].fd = pair[0];
+        workers[i].reader.fd = pair[0];
+        workers[i].reader.len = 0;
+        workers[i].reader.skip = false;
+    }
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (listener < 0 || strlen(socket_path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Socket invalide: %s\n", socket_path);
+        return 1;
+    }
+    strcpy(addr.sun_path, socket_path);
+    unlink(socket_path);
+    if (bind(listener, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(listener, 64) != 0) {
+        perror(socket_path);
+        return 1;
+    }
+
+    for (int i = 0; i < n_workers; i++) {
+        pthread_t thread;
+        pthread_create(&thread, NULL, dispatch_thread, &workers[i]);
+        pthread_detach(thread);
+    }
+    fprintf(stderr, "awale_daemon : %s, %d moteurs\n", socket_path, n_workers);
+
+    for (;;) {
+        int fd = accept(listener, NULL, NULL);
+        if (fd < 0) continue;
+        Client* c = malloc(sizeof(Client));
+        c->fd = fd;
+        c->refs = 1;
+        pthread_mutex_init(&c->write_lock, NULL);
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, client_thread, c) != 0) {
+            client_release(c);
+            continue;
+        }
+        pthread_detach(thread);
+    }
+}
+
+#endif // _WIN32
@@ -0,0 +1,144 @@
+// Client de test du démon d'analyse (awale_daemon)
+// Lit des requêtes JSON sur l'entrée standard (une par ligne), les répartit sur plusieurs
+// connexions envoyées en même temps, affiche chaque réponse puis le temps total.
+// Usage : daemon_client.exe [--socket chemin] [--connections C] [--repeat N] < requetes.ndjson
+// Exemple : echo '{"id":1,"position":"startpos","depth":8,"multipv":3}' | daemon_client.exe
+#define _POSIX_C_SOURCE 200809L
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+
+int main(void) {
+    fprintf(stderr, "daemon_client : sockets Unix non disponibles sous Windows\n");
+    return 1;
+}
+
+#else
+
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DEFAULT_SOCKET "/tmp/awale.sock"
+#define MAX_CONNECTIONS 64
+#define MAX_LINE 4096
+
+typedef struct {
+    const char* socket_path;
+    char** requests;
+    int n_requests;
+    int finals;     // Lignes finales reçues (bestmove ou error)
+    int errors;
+} Connection;
+
+static pthread_mutex_t print_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+// Envoie toutes les requêtes de la connexion d'un coup, puis lit jusqu'à la dernière réponse
+static void* connection_thread(void* arg) {
+    Connection* conn = arg;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, conn->socket_path, sizeof(addr.sun_path) - 1);
+    if (fd < 0 || connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        perror(conn->socket_path);
+        conn->errors = conn->n_requests;
+        if (fd >= 0) close(fd);
+        return NULL;
+    }
+
+    for (int i = 0; i < conn->n_requests; i++) {
+        if (write(fd, conn->requests[i], strlen(conn->requests[i])) < 0 || write(fd, "\n", 1) < 0) {
+            conn->errors = conn->n_requests;
+            close(fd);
+            return NULL;
+        }
+    }
+
+    FILE* in = fdopen(fd, "r");
+    char line[MAX_LINE];
+    while (conn->finals < conn->n_requests && fgets(line, sizeof(line), in)) {
+        pthread_mutex_lock(&print_lock);
+        fputs(line, stdout);
+        pthread_mutex_unlock(&print_lock);
+        if (strstr(line, "\"type\":\"bestmove\"")) conn->finals++;
+        if (strstr(line, "\"type\":\"error\"")) {
+            conn->finals++;
+            conn->errors++;
+        }
+    }
+    conn->errors += conn->n_requests - conn->finals;
+    fclose(in);
+    return NULL;
+}
+
+int main(int argc, char** argv) {
+    const char* socket_path = DEFAULT_SOCKET;
+    int n_connections = 1, repeat = 1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc) socket_path = argv[++i];
+        else if (strcmp(argv[i], "--connections") == 0 && i + 1 < argc) n_connections = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) repeat = atoi(argv[++i]);
+    }
+    if (n_connections < 1) n_connections = 1;
+    if (n_connections > MAX_CONNECTIONS) n_connections = MAX_CONNECTIONS;
+    if (repeat < 1) repeat = 1;
+
+    // Requêtes de l'entrée standard, répétées --repeat fois
+    char** lines = NULL;
+    int n_lines = 0, capacity = 0;
+    char line[MAX_LINE];
+    while (fgets(line, sizeof(line), stdin)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0') continue;
+        if (n_lines == capacity) {
+            capacity = capacity ? capacity * 2 : 16;
+            lines = realloc(lines, sizeof(char*) * capacity);
+        }
+        lines[n_lines++] = strdup(line);
+    }
+    int total = n_lines * repeat;
+    if (total == 0) {
+        fprintf(stderr, "Aucune requete sur l'entree standard\n");
+        return 1;
+    }
+    char** requests = malloc(sizeof(char*) * total);
+    for (int i = 0; i < total; i++) requests[i] = lines[i % n_lines];
+
+    // Requêtes consécutives par connexion
+    Connection conns[MAX_CONNECTIONS];
+    pthread_t threads[MAX_CONNECTIONS];
+    if (n_connections > total) n_connections = total;
+    uint64_t start = now_ms();
+    for (int c = 0, first = 0; c < n_connections; c++) {
+        int count = total / n_connections + (c < total % n_connections);
+        conns[c] = (Connection){socket_path, requests + first, count, 0, 0};
+        first += count;
+        pthread_create(&threads[c], NULL, connection_thread, &conns[c]);
+    }
+    int errors = 0;
+    for (int c = 0; c < n_connections; c++) {
+        pthread_join(threads[c], NULL);
+        errors += conns[c].errors;
+    }
+    uint64_t ms = now_ms() - start;
+
+    fprintf(stderr, "%d requetes, %d connexions, %d erreurs, %llu ms (%.1f requetes/s)\n", total,
+            n_connections, errors, (unsigned long long)ms, ms ? 1000.0 * total / (double)ms : 0.0);
+    return errors ? 1 : 0;
+}
+
+#endif // _WIN32
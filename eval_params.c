@@ -0,0 +1,58 @@
+#include "eval_params.h"
+#include <stdio.h>
+#include <string.h>
+
+// Poids réglés à la main (ceux de la version du tournoi)
+// (tempo, score par phase, graines, seuil des 40, famine, avance en graines,
+//  trous vulnérables / chargés / actifs, mobilité, potentiel de capture)
+#define EVAL_PARAMS_DEFAULT {30, 15, 100, 150, 200, 10, 100, 400, 300, 50, 15, 10, 5, 12, 8, 25, 15}
+
+const int eval_params_default[EVAL_PARAMS] = EVAL_PARAMS_DEFAULT;
+int eval_params[EVAL_PARAMS] = EVAL_PARAMS_DEFAULT;
+
+const char* const eval_param_names[EVAL_PARAMS] = {
+    "tempo_early", "tempo_late",
+    "score_early", "score_mid", "score_late",
+    "seeds",
+    "threshold",
+    "famine_self", "famine_opp",
+    "seed_lead_early",
+    "vulnerable", "loaded", "active_early",
+    "mobility_early", "mobility_late",
+    "potential_early", "potential_late",
+};
+
+// Une ligne par poids : "nom valeur" ; lignes vides et commentaires (#) ignorés
+bool eval_params_load(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (!f) return false;
+
+    int loaded[EVAL_PARAMS];
+    memcpy(loaded, eval_params, sizeof(loaded));
+    char line[256];
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), f)) {
+        char name[64];
+        int value;
+        if (line[strspn(line, " \t\r\n")] == '\0' || line[strspn(line, " \t")] == '#') continue;
+        if (sscanf(line, "%63s %d", name, &value) != 2) {
+            ok = false;
+            break;
+        }
+        int p = 0;
+        while (p < EVAL_PARAMS && strcmp(name, eval_param_names[p]) != 0) p++;
+        if (p == EVAL_PARAMS) ok = false;
+        else loaded[p] = value;
+    }
+    fclose(f);
+    if (ok) memcpy(eval_params, loaded, sizeof(loaded));
+    return ok;
+}
+
+bool eval_params_save(const char* path, const int params[EVAL_PARAMS]) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "# Poids de l'évaluation (awale, --eval-params)\n");
+    for (int p = 0; p < EVAL_PARAMS; p++) fprintf(f, "%s %d\n", eval_param_names[p], params[p]);
+    return fclose(f) == 0;
+}
@@ -0,0 +1,40 @@
+#ifndef EVAL_PARAMS_H
+#define EVAL_PARAMS_H
+
+#include <stdbool.h>
+
+// POIDS DE L'ÉVALUATION
+// Table des poids de evaluate() (valeurs par défaut dans eval_params.c), remplaçable
+// au lancement par un fichier texte "nom valeur" (--eval-params), produit par tune.exe.
+// Hors fins de partie, la note est la somme des poids multipliés par leur terme.
+
+typedef enum {
+    EP_TEMPO_EARLY,       // Bonus pour jouer (moins de 20 graines capturées)
+    EP_TEMPO_LATE,
+    EP_SCORE_EARLY,       // Différence de score, par phase (capturées < 20, < 60, au-delà)
+    EP_SCORE_MID,
+    EP_SCORE_LATE,
+    EP_SEEDS,             // Différence de graines dans chaque camp
+    EP_THRESHOLD,         // Par graine au-delà de 39 (chacun des deux joueurs)
+    EP_FAMINE_SELF,       // Malus : moins de 5 graines chez nous, plus de 10 chez l'adversaire
+    EP_FAMINE_OPP,        // Bonus : l'inverse
+    EP_SEED_LEAD_EARLY,   // Plus de 3 graines d'avance dans notre camp (début de partie)
+    EP_VULNERABLE,        // Trous à 1 ou 2 graines (adversaire - nous)
+    EP_LOADED,            // Trous à 6 graines ou plus
+    EP_ACTIVE_EARLY,      // Trous à 2..10 graines (début de partie)
+    EP_MOBILITY_EARLY,
+    EP_MOBILITY_LATE,
+    EP_POTENTIAL_EARLY,   // Meilleure capture immédiate
+    EP_POTENTIAL_LATE,
+    EVAL_PARAMS
+} EvalParam;
+
+extern int eval_params[EVAL_PARAMS];
+extern const int eval_params_default[EVAL_PARAMS];
+extern const char* const eval_param_names[EVAL_PARAMS];
+
+// Les noms absents du fichier gardent leur valeur ; nom inconnu ou ligne illisible => false
+bool eval_params_load(const char* path);
+bool eval_params_save(const char* path, const int params[EVAL_PARAMS]);
+
+#endif // EVAL_PARAMS_H
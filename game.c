@@ -11,6 +11,7 @@ void game_init(GameState *g) {
     g->score[2] = 0; // Joueur 2
     g->current = 1;   // Commencer avec le joueur 1
     g->total_moves = 0; // Reset compteur total (limite 400)
+    g->half_moves_without_capture = 0;
 }
 
 // Fonction pour vérifier si un joueur peut jouer 
@@ -69,70 +70,114 @@ static void check_affamation(GameState *g, int player) {
     int opponent = (player == 1) ? 2 : 1;
     int opponent_seeds = 0;
     
- 
-    if(DEBUG_MODE) {
-        printf("\n=== VÉRIFICATION AFFAMATION ===\n");
-        printf("   Joueur actif: %d\n", player);
-        printf("   Adversaire: %d\n", opponent);
-    }
-    
-    // Compter les graines de l'adversaire
-    for(int i = 0; i < N_HOLES; i++) {
-        // Vérifier si ce trou appartient à l'adversaire
-
-        int is_opponent_hole = (opponent == 1) ? (i % 2 == 0) : (i % 2 == 1);
-        
-        if(is_opponent_hole) {
-            int seeds_in_hole = g->board.holes[i].red + 
-                               g->board.holes[i].blue + 
-                               g->board.holes[i].transparent;
-            if(DEBUG_MODE && seeds_in_hole > 0) {
-                printf("   Trou %d (adversaire): %d graines\n", i+1, seeds_in_hole);
-            }
-            opponent_seeds += seeds_in_hole;
-        }
+    // Compter les graines de l'adversaire (J1: indices pairs, J2: indices impairs)
+    for(int i = opponent - 1; i < N_HOLES; i += 2) {
+        opponent_seeds += g->board.holes[i].red + 
+                          g->board.holes[i].blue + 
+                          g->board.holes[i].transparent;
     }
     
     if(DEBUG_MODE) {
+        printf("\n=== VÉRIFICATION AFFAMATION ===\n");
+        printf("   Joueur actif: %d, adversaire: %d\n", player, opponent);
         printf("   Total graines adversaire: %d\n", opponent_seeds);
     }
     
+    if(opponent_seeds != 0) return;
+    
     // Si l'adversaire n'a plus de graines, capturer toutes les siennes (du joueur actif)
-    if(opponent_seeds == 0) {
-        if(DEBUG_MODE) {
-            printf("AFFAMATION DÉTECTÉE ! L'adversaire n'a plus de graines.\n");
-            printf(" → Capture de TOUTES les graines du joueur %d\n", player);
-        }
-        
-        int captured = 0;
-        for(int i = 0; i < N_HOLES; i++) {
-            // Vérifier si ce trou appartient au joueur actif
-            int is_player_hole = (player == 1) ? (i % 2 == 0) : (i % 2 == 1);
-            
-            if(is_player_hole) {
-                int seeds_in_hole = g->board.holes[i].red + 
-                                   g->board.holes[i].blue + 
-                                   g->board.holes[i].transparent;
-                if(DEBUG_MODE && seeds_in_hole > 0) {
-                    printf("   Trou %d: capture %d graines\n", i+1, seeds_in_hole);
-                }
-                captured += seeds_in_hole;
-                g->board.holes[i].red = 0;
-                g->board.holes[i].blue = 0;
-                g->board.holes[i].transparent = 0;
-            }
-        }
-        g->score[player] += captured;
-        
-        if(DEBUG_MODE) {
-            printf("   Total capturé: %d graines\n", captured);
-            printf("   Nouveau score joueur %d: %d\n", player, g->score[player]);
-            printf("====================================\n\n");
-        }
-    } else if(DEBUG_MODE) {
-        printf(" Pas d'affamation (adversaire a encore des graines)\n");
-        printf("====================================\n\n");
+    int captured = 0;
+    for(int i = player - 1; i < N_HOLES; i += 2) {
+        captured += g->board.holes[i].red + 
+                    g->board.holes[i].blue + 
+                    g->board.holes[i].transparent;
+        g->board.holes[i].red = 0;
+        g->board.holes[i].blue = 0;
+        g->board.holes[i].transparent = 0;
+    }
+    g->score[player] += captured;
+    
+    if(DEBUG_MODE) {
+        printf("AFFAMATION DÉTECTÉE ! Joueur %d capture %d graines (score %d)\n",
+               player, captured, g->score[player]);
+    }
+}
+
+// NOYAU DES RÈGLES
+// Utilisé à la fois par l'arbitre local (game_move) et par la recherche (apply_move)
+// Le coup doit être légal (trou du joueur courant), on ne le revérifie pas ici
+
+// Fin d'un coup une fois semé : score, famine, changement de joueur
+static FORCE_INLINE void finish_move(GameState *g, int score_gain, int player) {
+    int next = (player == 1) ? 2 : 1;
+
+    // Incrémente le compteur total de coups
+    g->total_moves++;
+    
+    // Ajouter les graines capturées au score
+    g->score[player] += score_gain;
+    
+    // Vérifie l'affamation
+    check_affamation(g, player);
+    
+    // Passe au joueur suivant (même si la partie est finie : la recherche
+    // évalue toujours du point de vue du joueur au trait)
+    g->current = next;
+    
+    // Si le joueur suivant ne peut pas jouer, on capture tout le reste
+    if(!check_end_conditions(g) && !can_player_move(g, next)) {
+        check_affamation(g, next);
+    }
+}
+
+// side = 1 ou 2 : variante spécialisée (camp au trait constant), 0 : version générique
+static FORCE_INLINE int game_play_side(GameState *g, int hole, Color color, int side) {
+    int player = side ? side : g->current;
+
+    // Exécute le semis et la capture
+    int score_gain = 0;
+    int sown = (side == 1)   ? sow_and_capture_p1(&g->board, hole, color, &score_gain)
+               : (side == 2) ? sow_and_capture_p2(&g->board, hole, color, &score_gain)
+                             : sow_and_capture(&g->board, hole, color, &score_gain, player);
+    if(!sown) {
+        return 0; // Trou vide
+    }
+    finish_move(g, score_gain, player);
+    return 1;
+}
+
+int game_play(GameState *g, int hole, Color color) {
+    return game_play_side(g, hole, color, 0);
+}
+
+int game_play_p1(GameState *g, int hole, Color color) {
+    return game_play_side(g, hole, color, 1);
+}
+
+int game_play_p2(GameState *g, int hole, Color color) {
+    return game_play_side(g, hole, color, 2);
+}
+
+// Coup déjà analysé par sow_moves (expansion groupée) sur ce plateau
+static FORCE_INLINE int game_play_sown_side(GameState *g, const SownMove *move, int side) {
+    if(move->landing < 0) {
+        return 0; // Trou vide
     }
+    sow_apply(&g->board, move);
+    finish_move(g, move->gain, side ? side : g->current);
+    return 1;
+}
+
+int game_play_sown(GameState *g, const SownMove *move) {
+    return game_play_sown_side(g, move, 0);
+}
+
+int game_play_sown_p1(GameState *g, const SownMove *move) {
+    return game_play_sown_side(g, move, 1);
+}
+
+int game_play_sown_p2(GameState *g, const SownMove *move) {
+    return game_play_sown_side(g, move, 2);
 }
 
 int game_move(GameState *g, const char *move_str) {
@@ -149,37 +194,7 @@ int game_move(GameState *g, const char *move_str) {
         return 0; // Coup invalide
     }
     
-    // Exécute le semis et la capture
-    int score_gain = 0;
-    if(!sow_and_capture(&g->board, hole, color, &score_gain, g->current)) {
-        return 0; // Erreur lors du semis
-    }
-    
-    // Incrémente le compteur total de coups
-    g->total_moves++;
-    
-
-    // Ajouter les graines capturées au score
-    g->score[g->current] += score_gain;
-    
-    // Vérifie l'affamation
-    check_affamation(g, g->current);
-    
-    // Vérifie les conditions de fin de partie
-    if(check_end_conditions(g)) {
-        return 1; // Coup valide, mais partie terminée
-    }
-    
-    // Passe au joueur suivant
-    g->current = (g->current == 1) ? 2 : 1;
-    
-    // Si le joueur suivant ne peut pas jouer, continue avec l'autre
-    if(!can_player_move(g, g->current)) {
-        check_affamation(g, g->current); // On capture tout le reste
-        return 1;
-    }
-    
-    return 1; // Coup valide
+    return game_play(g, hole, color);
 }
 
 int game_over(const GameState *g) {
@@ -204,3 +219,63 @@ int get_player_score(const GameState *g, int player) {
     }
     return 0;
 }
+
+// Lit un entier positif et avance le pointeur, renvoie -1 si rien à lire
+static int read_number(const char **s) {
+    while (**s == ' ') (*s)++;
+    if (**s < '0' || **s > '9') return -1;
+    int n = 0;
+    while (**s >= '0' && **s <= '9') {
+        n = n * 10 + (**s - '0');
+        (*s)++;
+    }
+    return n;
+}
+
+// Charge une position depuis la notation compacte (cf. game.h)
+// Renvoie 1 si OK, 0 si la chaîne est mal formée (g n'est alors pas modifié)
+int game_from_string(GameState *g, const char *str) {
+    GameState tmp;
+    game_init(&tmp);
+    const char *s = str;
+
+    for (int i = 0; i < N_HOLES; i++) {
+        int r = read_number(&s);
+        if (r < 0 || *s++ != '.') return 0;
+        int b = read_number(&s);
+        if (b < 0 || *s++ != '.') return 0;
+        int t = read_number(&s);
+        if (t < 0) return 0;
+        if (i < N_HOLES - 1 && *s++ != '/') return 0;
+        tmp.board.holes[i].red = r;
+        tmp.board.holes[i].blue = b;
+        tmp.board.holes[i].transparent = t;
+    }
+
+    tmp.current = read_number(&s);
+    if (tmp.current != 1 && tmp.current != 2) return 0;
+    tmp.score[1] = read_number(&s);
+    tmp.score[2] = read_number(&s);
+    if (tmp.score[1] < 0 || tmp.score[2] < 0) return 0;
+
+    // Le nombre de coups joués est optionnel
+    int n = read_number(&s);
+    tmp.total_moves = (n < 0) ? 0 : n;
+
+    *g = tmp;
+    return 1;
+}
+
+// Écrit la position en notation compacte
+void game_to_string(const GameState *g, char *buf, int size) {
+    int len = 0;
+    for (int i = 0; i < N_HOLES && len < size; i++) {
+        len += snprintf(buf + len, size - len, "%d.%d.%d%s",
+                        g->board.holes[i].red, g->board.holes[i].blue,
+                        g->board.holes[i].transparent, (i < N_HOLES - 1) ? "/" : "");
+    }
+    if (len < size) {
+        snprintf(buf + len, size - len, " %d %d %d %d",
+                 g->current, g->score[1], g->score[2], g->total_moves);
+    }
+}
@@ -2,6 +2,8 @@
 #define GAME_H
 
 #include "board.h"
+#include "move.h"
+#include "sow_and_capture.h"
 
 typedef struct {
     Board board;
@@ -13,10 +15,21 @@ typedef struct {
 
 void game_init(GameState *g);
 int  game_move(GameState *g, const char *move_str);
+int  game_play(GameState *g, int hole, Color color); // Noyau des règles (coup déjà validé)
+int  game_play_p1(GameState *g, int hole, Color color); // Idem, joueur 1 au trait
+int  game_play_p2(GameState *g, int hole, Color color); // Idem, joueur 2 au trait
+int  game_play_sown(GameState *g, const SownMove *move); // Idem, coup déjà analysé (sow_moves)
+int  game_play_sown_p1(GameState *g, const SownMove *move);
+int  game_play_sown_p2(GameState *g, const SownMove *move);
 int  game_over(const GameState *g);
 int  get_game_result(const GameState *g);
 int  get_player_score(const GameState *g, int player);
 
+// Notation compacte d'une position :
+// "R.B.T/R.B.T/.../R.B.T J S1 S2 N" (16 trous, joueur au trait, scores, nb de coups)
+int  game_from_string(GameState *g, const char *str);
+void game_to_string(const GameState *g, char *buf, int size);
+
 // Mode debug
 void set_debug_mode(int enabled);
 
@@ -0,0 +1,61 @@
+// Générateur des tables Zobrist (exécuté sur la machine hôte par le Makefile)
+// Usage : gen_zobrist > zobrist_table.c
+#include <stdio.h>
+#include <stdint.h>
+#include "zobrist.h"
+
+// Même générateur que l'ancien tt_init(), mais avec une graine fixe
+// https://en.wikipedia.org/wiki/Xorshift
+static uint64_t xorshift64_state = ZOBRIST_SEED;
+
+static uint64_t xorshift64(void) {
+    uint64_t x = xorshift64_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    xorshift64_state = x;
+    return x;
+}
+
+static void print_values(int n, const char* indent) {
+    for (int i = 0; i < n; i++) {
+        if (i % 4 == 0) printf("%s", indent);
+        printf("0x%016llXULL,", (unsigned long long)xorshift64());
+        printf((i % 4 == 3 || i == n - 1) ? "\n" : " ");
+    }
+}
+
+int main(void) {
+    printf("// Fichier généré par gen_zobrist.c, ne pas modifier à la main\n");
+    printf("#include \"zobrist.h\"\n\n");
+
+    // Même ordre de tirage que l'ancien tt_init()
+    printf("const uint64_t zobrist_keys[N_HOLES][3][MAX_SEEDS_PER_HOLE] = {\n");
+    for (int hole = 0; hole < N_HOLES; hole++) {
+        printf("    {\n");
+        for (int seed_type = 0; seed_type < 3; seed_type++) {
+            printf("        {\n");
+            print_values(MAX_SEEDS_PER_HOLE, "            ");
+            printf("        },\n");
+        }
+        printf("    },\n");
+    }
+    printf("};\n\n");
+
+    printf("const uint64_t zobrist_player[2] = {\n");
+    print_values(2, "    ");
+    printf("};\n\n");
+
+    printf("const uint64_t zobrist_scores[3][ZOBRIST_MAX_SCORE] = {\n");
+    for (int player = 0; player < 3; player++) {
+        printf("    {\n");
+        print_values(ZOBRIST_MAX_SCORE, "        ");
+        printf("    },\n");
+    }
+    printf("};\n\n");
+
+    printf("const uint64_t zobrist_half_moves[ZOBRIST_MAX_HALF_MOVES] = {\n");
+    print_values(ZOBRIST_MAX_HALF_MOVES, "    ");
+    printf("};\n");
+    return 0;
+}
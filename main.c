@@ -1,8 +1,14 @@
 #include "ai.h"
+#include "ai_advanced.h"
 #include "ai_interface.h"
+#include "ai_mcts.h"
+#include "eval_params.h"
 #include "game.h"
 #include "move.h"
+#include "pn_search.h"
+#include "trace.h"
 #include <ctype.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -12,6 +18,14 @@
 
 static GameState game;
 static int my_id = 0; // 1 ou 2
+static AIPlayer *engine = &AI_Advanced; // Choisie par --engine
+
+// Recherche lancée par "go" dans un thread à part (pour pouvoir lire "stop")
+static pthread_t search_thread;
+static bool search_running = false;
+static volatile bool search_stop = false;
+static GameState search_game;
+static SearchLimits search_limits;
 
 // Envoi du coup au format attendu par l'arbitre
 static void send_move(AIMove move) {
@@ -23,6 +37,126 @@ static void send_move(AIMove move) {
   fflush(stdout);
 }
 
+// PROTOCOLE ÉTENDU (hors arbitre)
+// newgame | position startpos|<notation> [moves ...] | go [depth N]
+// [movetime N] [nodes N] | stop | isready | print | quit
+
+static void report_info(const SearchInfo *info) {
+  printf("info depth %d score %d nodes %llu time %d pv %d%s\n", info->depth,
+         info->score, (unsigned long long)info->nodes, info->time_ms,
+         info->best_move.hole, color_to_string(info->best_move.color));
+  fflush(stdout);
+}
+
+static void *search_worker(void *arg) {
+  (void)arg;
+  AIMove best = {0, RED};
+  engine->search(&search_game, &search_limits, &best);
+  if (best.hole == 0) {
+    printf("bestmove none\n");
+    fflush(stdout);
+  } else {
+    printf("bestmove ");
+    send_move(best);
+  }
+  return NULL;
+}
+
+// Arrête la recherche en cours (s'il y en a une) et attend la fin du thread
+static void stop_search_thread(void) {
+  if (!search_running)
+    return;
+  search_stop = true;
+  pthread_join(search_thread, NULL);
+  search_running = false;
+}
+
+static void start_search_thread(const char *args) {
+  stop_search_thread();
+
+  memset(&search_limits, 0, sizeof(search_limits));
+  char buf[256];
+  strncpy(buf, args, sizeof(buf) - 1);
+  buf[sizeof(buf) - 1] = '\0';
+
+  for (char *tok = strtok(buf, " "); tok; tok = strtok(NULL, " ")) {
+    char *val = strtok(NULL, " ");
+    if (!val)
+      break;
+    if (strcmp(tok, "depth") == 0)
+      search_limits.depth = atoi(val);
+    else if (strcmp(tok, "movetime") == 0)
+      search_limits.movetime_ms = atoi(val);
+    else if (strcmp(tok, "nodes") == 0)
+      search_limits.nodes = strtoull(val, NULL, 10);
+  }
+  search_limits.stop = &search_stop;
+  search_limits.report = report_info;
+
+  search_game = game;
+  search_stop = false;
+  if (pthread_create(&search_thread, NULL, search_worker, NULL) == 0) {
+    search_running = true;
+  } else {
+    search_worker(NULL); // Pas de thread dispo : on cherche directement
+  }
+}
+
+// "position startpos|<notation> [moves 1R 2TB ...]"
+static int set_position(char *args) {
+  char *moves = strstr(args, "moves");
+  if (moves) {
+    *moves = '\0';
+    moves += 5;
+  }
+
+  GameState g;
+  if (strncmp(args, "startpos", 8) == 0) {
+    game_init(&g);
+  } else if (!game_from_string(&g, args)) {
+    return 0;
+  }
+
+  for (char *tok = moves ? strtok(moves, " ") : NULL; tok;
+       tok = strtok(NULL, " ")) {
+    if (!game_move(&g, tok))
+      return 0;
+  }
+  game = g;
+  my_id = 0;
+  return 1;
+}
+
+// Renvoie 1 si la ligne était une commande du protocole étendu
+static int handle_command(char *input) {
+  if (strcmp(input, "stop") == 0) {
+    stop_search_thread();
+  } else if (strcmp(input, "isready") == 0) {
+    printf("readyok\n");
+    fflush(stdout);
+  } else if (strcmp(input, "newgame") == 0) {
+    // La TT reste valide d'une partie à l'autre : on la garde chaude
+    stop_search_thread();
+    game_init(&game);
+    engine->new_game();
+    my_id = 0;
+  } else if (strncmp(input, "position ", 9) == 0) {
+    stop_search_thread();
+    if (!set_position(input + 9))
+      fprintf(stderr, "Err position: %s\n", input + 9);
+  } else if (strcmp(input, "go") == 0 || strncmp(input, "go ", 3) == 0) {
+    start_search_thread(input + 2);
+  } else if (strcmp(input, "print") == 0) {
+    char buf[256];
+    game_to_string(&game, buf, sizeof(buf));
+    printf("%s\n", buf);
+    fflush(stdout);
+  } else {
+    return 0;
+  }
+  return 1;
+}
+
 // Parsing (Input arbitre 1-16 -> Interne GameState)
 static int apply_arbitre_move(const char *str) {
   int hole;
@@ -62,26 +196,92 @@ static int apply_arbitre_move(const char *str) {
   return game_move(&game, move_cmd);
 }
 
-int main(void) {
+int main(int argc, char **argv) {
   // Initialisations
   tt_init();
-  AI_Advanced.init();
+
+  // Options : --tt-file <chemin> pour garder la table de transposition sur disque,
+  // --tt-shared <nom> pour la partager entre processus (mémoire partagée),
+  // --engine advanced|mcts pour choisir l'IA, --threads N pour MCTS
+  // --trace <fichier> pour tracer la recherche (compilé avec TRACE=1)
+  // --solver <distance> <part %> : solveur de fin de partie à <distance> graines des 49
+  // (part 0 = désactivé)
+  // --eval-params <fichier> : poids de l'évaluation (produits par tune.exe)
+  // --futility|--razoring|--probcut <marge> : élagage sélectif (0 = désactivé)
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--tt-file") == 0 && i + 1 < argc) {
+      if (!tt_open_file(argv[++i]))
+        fprintf(stderr, "TT fichier indisponible: %s\n", argv[i]);
+    } else if (strcmp(argv[i], "--tt-shared") == 0 && i + 1 < argc) {
+      if (!tt_open_shared(argv[++i]))
+        fprintf(stderr, "TT partagee indisponible: %s\n", argv[i]);
+    } else if (strcmp(argv[i], "--engine") == 0 && i + 1 < argc) {
+      i++;
+      if (strcmp(argv[i], "mcts") == 0)
+        engine = &AI_MCTS;
+      else if (strcmp(argv[i], "advanced") == 0)
+        engine = &AI_Advanced;
+      else
+        fprintf(stderr, "IA inconnue: %s\n", argv[i]);
+    } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      mcts_set_threads(atoi(argv[++i]));
+    } else if (strcmp(argv[i], "--solver") == 0 && i + 2 < argc) {
+      pn_config.score_distance = atoi(argv[++i]);
+      pn_config.slice_percent = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--eval-params") == 0 && i + 1 < argc) {
+      if (!eval_params_load(argv[++i]))
+        fprintf(stderr, "Poids illisibles: %s\n", argv[i]);
+    } else if (strcmp(argv[i], "--futility") == 0 && i + 1 < argc) {
+      prune_config.futility_margin = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--razoring") == 0 && i + 1 < argc) {
+      prune_config.razor_margin = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--probcut") == 0 && i + 1 < argc) {
+      prune_config.probcut_margin = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+      i++;
+#ifdef TRACE
+      if (!trace_open(argv[i]))
+        fprintf(stderr, "Trace indisponible: %s\n", argv[i]);
+#else
+      fprintf(stderr, "Trace non compilee (make TRACE=1)\n");
+#endif
+    }
+  }
+  engine->init();
   game_init(&game);
 
-  char input[256];
+  char input[8192]; // "position ... moves" peut être long
 
   // Lecture de l'entrée standard (boucle bloquante)
   while (fgets(input, sizeof(input), stdin) != NULL) {
+    // Ligne plus longue que le tampon : on la jette jusqu'au '\n' plutôt que
+    // d'en jouer les morceaux comme des commandes
+    if (!strchr(input, '\n') && !feof(stdin)) {
+      int c;
+      while ((c = getchar()) != EOF && c != '\n') {
+      }
+      fprintf(stderr, "Err commande: ligne trop longue\n");
+      continue;
+    }
     // Nettoyage string
     input[strcspn(input, "\r\n")] = '\0';
     if (strlen(input) == 0)
       continue;
 
     // 1. GESTION FIN DE PARTIE
-    if (strcmp(input, "END") == 0 || strncmp(input, "RESULT", 6) == 0) {
+    if (strcmp(input, "END") == 0 || strncmp(input, "RESULT", 6) == 0 ||
+        strcmp(input, "quit") == 0) {
       break;
     }
 
+    // Commandes du protocole étendu (les coups commencent par un chiffre)
+    if (!isdigit((unsigned char)input[0]) && strcmp(input, "START") != 0) {
+      if (!handle_command(input))
+        fprintf(stderr, "Err commande: %s\n", input);
+      continue;
+    }
+    stop_search_thread();
+
     // 2. GESTION START (Je suis Joueur 1)
     if (strcmp(input, "START") == 0) {
       my_id = 1;
@@ -89,7 +289,7 @@ int main(void) {
 
       // Calcul et envoi
       AIMove best;
-      AI_Advanced.get_best_move(&game, TIMEOUT_MS, &best);
+      engine->get_best_move(&game, TIMEOUT_MS, &best);
 
       // Appliquer mon coup sur MON plateau local pour rester synchro
       char my_move_str[16];
@@ -127,7 +327,7 @@ int main(void) {
       continue;
 
     AIMove best;
-    AI_Advanced.get_best_move(&game, TIMEOUT_MS, &best);
+    engine->get_best_move(&game, TIMEOUT_MS, &best);
 
     // Appliquer mon propre coup localement
     char my_move_str[16];
@@ -142,7 +342,11 @@ int main(void) {
     send_move(best);
   }
 
-  AI_Advanced.cleanup();
+  stop_search_thread();
+  engine->cleanup();
   tt_cleanup();
+#ifdef TRACE
+  trace_close();
+#endif
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,327 @@
+// Microbenchmarks des noyaux de règles et de recherche
+// Chaque noyau est chronométré seul sur un lot de plateaux réalistes (parties aléatoires),
+// avec échauffement puis répétitions ; on affiche la médiane et le p99 en ns par appel.
+// Usage : microbench.exe [--json] [répétitions]
+#define _POSIX_C_SOURCE 200112L
+#include "ai.h"
+#include "ai_advanced.h"
+#include "game.h"
+#include "sow_and_capture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define N_BOARDS 4096
+#define WARMUP_RUNS 5
+#define DEFAULT_RUNS 200
+
+// Un plateau de test avec tout ce qu'il faut pour appeler chaque noyau
+typedef struct {
+    GameState game;
+    AIMove move;          // Un coup légal au hasard
+    AIMove moves[64];     // Tous les coups légaux
+    int n_moves;
+    SownMove sown[32];    // Leur expansion (expand_moves), pour le tri
+    uint64_t hash;
+} Sample;
+
+static Sample samples[N_BOARDS];
+static EvalBatch batches[N_BOARDS / EVAL_BATCH_MAX];
+static volatile uint64_t sink; // Empêche le compilateur de supprimer les appels
+
+static uint64_t rng_state = 0x2545F4914F6CDD1DULL;
+
+static uint64_t rng_next(void) {
+    uint64_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    rng_state = x;
+    return x;
+}
+
+static uint64_t now_ns(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, t;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&t);
+    return (uint64_t)(t.QuadPart * 1000000000.0 / freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+// Plateaux tirés de parties aléatoires, à un nombre de coups aléatoire (0 à 120)
+static void build_samples(void) {
+    int count = 0;
+    while (count < N_BOARDS) {
+        GameState game;
+        game_init(&game);
+        int plies = (int)(rng_next() % 120);
+        for (int i = 0; i < plies && !game_over(&game); i++) {
+            AIMove moves[64];
+            int n = generate_legal_moves(&game.board, game.current, moves);
+            if (n == 0) break;
+            apply_move(&game, moves[rng_next() % n]);
+        }
+        if (game_over(&game)) continue;
+
+        Sample* s = &samples[count++];
+        s->game = game;
+        s->n_moves = generate_legal_moves(&game.board, game.current, s->moves);
+        s->move = s->moves[rng_next() % s->n_moves];
+        expand_moves(&game.board, s->moves, s->n_moves, s->sown);
+        s->hash = zobrist_hash(&game.board, game.current, game.score);
+    }
+
+    for (int i = 0; i < N_BOARDS; i++) {
+        EvalBatch* batch = &batches[i / EVAL_BATCH_MAX];
+        ai_batch_set(batch, i % EVAL_BATCH_MAX, &samples[i].game.board, samples[i].game.current,
+                     samples[i].game.score);
+        batch->count = i % EVAL_BATCH_MAX + 1;
+    }
+}
+
+// L'évaluation par lots doit donner exactement les mêmes notes que l'évaluation scalaire
+static int check_evaluate_batch(void) {
+    int out[EVAL_BATCH_MAX];
+    int errors = 0;
+    for (int i = 0; i < N_BOARDS; i += EVAL_BATCH_MAX) {
+        ai_evaluate_batch(&batches[i / EVAL_BATCH_MAX], out);
+        for (int k = 0; k < EVAL_BATCH_MAX; k++) {
+            const Sample* s = &samples[i + k];
+            int expected = ai_evaluate(&s->game.board, s->game.current, s->game.score);
+            if (out[k] != expected && errors++ < 5) {
+                char buf[256];
+                game_to_string(&s->game, buf, sizeof(buf));
+                fprintf(stderr, "evaluate_batch: %d au lieu de %d pour %s\n", out[k], expected, buf);
+            }
+        }
+    }
+    return errors;
+}
+
+// LES NOYAUX (un passage sur tous les plateaux)
+
+static void run_sow_and_capture(void) {
+    uint64_t acc = 0;
+    for (int i = 0; i < N_BOARDS; i++) {
+        Board b = samples[i].game.board;
+        int gain;
+        sow_and_capture(&b, samples[i].move.hole - 1, samples[i].move.color, &gain,
+                        samples[i].game.current);
+        acc += (uint64_t)gain;
+    }
+    sink += acc;
+}
+
+static void run_quick_predict_score(void) {
+    uint64_t acc = 0;
+    for (int i = 0; i < N_BOARDS; i++) {
+        acc += (uint64_t)quick_predict_score(&samples[i].game.board, samples[i].move.hole - 1,
+                                             samples[i].move.color, samples[i].game.current);
+    }
+    sink += acc;
+}
+
+static void run_static_exchange(void) {
+    uint64_t acc = 0;
+    for (int i = 0; i < N_BOARDS; i++) {
+        int gain;
+        acc += (uint64_t)static_exchange(&samples[i].game.board, samples[i].move.hole - 1,
+                                         samples[i].move.color, samples[i].game.current, &gain);
+        acc += (uint64_t)gain;
+    }
+    sink += acc;
+}
+
+// Gains de tous les coups d'un noeud (entrée du tri) : estimation coup par coup,
+// puis expansion groupée (rafle exacte et trou d'arrivée en une passe)
+static void run_predict_all_moves(void) {
+    uint64_t acc = 0;
+    for (int i = 0; i < N_BOARDS; i++) {
+        for (int k = 0; k < samples[i].n_moves; k++) {
+            acc += (uint64_t)quick_predict_score(&samples[i].game.board, samples[i].moves[k].hole - 1,
+                                                 samples[i].moves[k].color, samples[i].game.current);
+        }
+    }
+    sink += acc;
+}
+
+static void run_expand_moves(void) {
+    uint64_t acc = 0;
+    SownMove sown[64];
+    for (int i = 0; i < N_BOARDS; i++) {
+        expand_moves(&samples[i].game.board, samples[i].moves, samples[i].n_moves, sown);
+        for (int k = 0; k < samples[i].n_moves; k++) acc += (uint64_t)sown[k].gain;
+    }
+    sink += acc;
+}
+
+static void run_generate_legal_moves(void) {
+    uint64_t acc = 0;
+    AIMove moves[64];
+    for (int i = 0; i < N_BOARDS; i++) {
+        acc += (uint64_t)generate_legal_moves(&samples[i].game.board, samples[i].game.current, moves);
+    }
+    sink += acc;
+}
+
+static void run_generate_moves_side(void) {
+    uint64_t acc = 0;
+    AIMove moves[64];
+    for (int i = 0; i < N_BOARDS; i++) {
+        const Board* b = &samples[i].game.board;
+        acc += (uint64_t)((samples[i].game.current == 1) ? generate_legal_moves_p1(b, moves)
+                                                          : generate_legal_moves_p2(b, moves));
+    }
+    sink += acc;
+}
+
+static void run_zobrist_hash(void) {
+    uint64_t acc = 0;
+    for (int i = 0; i < N_BOARDS; i++) {
+        acc ^= zobrist_hash(&samples[i].game.board, samples[i].game.current, samples[i].game.score);
+    }
+    sink += acc;
+}
+
+static void run_tt_store(void) {
+    for (int i = 0; i < N_BOARDS; i++) {
+        tt_store(samples[i].hash, i & 15, i, EXACT, samples[i].move);
+    }
+}
+
+static void run_tt_probe(void) {
+    uint64_t acc = 0;
+    TTEntry e;
+    for (int i = 0; i < N_BOARDS; i++) {
+        acc += tt_probe(samples[i].hash, 0, -1000000, 1000000, &e);
+    }
+    sink += acc;
+}
+
+static void run_evaluate(void) {
+    uint64_t acc = 0;
+    for (int i = 0; i < N_BOARDS; i++) {
+        acc += (uint64_t)ai_evaluate(&samples[i].game.board, samples[i].game.current,
+                                     samples[i].game.score);
+    }
+    sink += acc;
+}
+
+static void run_evaluate_batch(void) {
+    uint64_t acc = 0;
+    int out[EVAL_BATCH_MAX];
+    for (int i = 0; i < N_BOARDS / EVAL_BATCH_MAX; i++) {
+        ai_evaluate_batch(&batches[i], out);
+        acc += (uint64_t)out[0];
+    }
+    sink += acc;
+}
+
+// Tri comme dans la recherche : coups déjà expansés, sans coup TT, à une profondeur
+// donnée (près des feuilles, l'échange statique n'est pas calculé)
+static void sort_moves_at(int depth) {
+    uint64_t acc = 0;
+    AIMove moves[64];
+    AIMove no_tt_move = {0, RED};
+    for (int i = 0; i < N_BOARDS; i++) {
+        memcpy(moves, samples[i].moves, sizeof(AIMove) * samples[i].n_moves);
+        ai_sort_moves(moves, samples[i].n_moves, no_tt_move, 2, depth, &samples[i].game.board,
+                      samples[i].game.current, samples[i].sown);
+        acc += (uint64_t)moves[0].hole;
+    }
+    sink += acc;
+}
+
+static void run_sort_moves(void) {
+    sort_moves_at(1);
+}
+
+static void run_sort_moves_see(void) {
+    sort_moves_at(6);
+}
+
+typedef struct {
+    const char* name;
+    void (*run)(void);
+} Kernel;
+
+static const Kernel kernels[] = {
+    {"sow_and_capture", run_sow_and_capture},
+    {"quick_predict_score", run_quick_predict_score},
+    {"static_exchange", run_static_exchange},
+    {"predict_all_moves", run_predict_all_moves},
+    {"expand_moves", run_expand_moves},
+    {"generate_legal_moves", run_generate_legal_moves},
+    {"generate_moves_side", run_generate_moves_side},
+    {"zobrist_hash", run_zobrist_hash},
+    {"tt_store", run_tt_store},
+    {"tt_probe", run_tt_probe},
+    {"evaluate", run_evaluate},
+    {"evaluate_batch", run_evaluate_batch},
+    {"sort_moves", run_sort_moves},
+    {"sort_moves_see", run_sort_moves_see},
+};
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char** argv) {
+    bool json = false;
+    int runs = DEFAULT_RUNS;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (atoi(argv[i]) > 0) runs = atoi(argv[i]);
+    }
+
+    tt_init();
+    build_samples();
+    if (check_evaluate_batch() != 0) return 1;
+
+    uint64_t* times = malloc(sizeof(uint64_t) * runs);
+    if (!times) return 1;
+
+    int n_kernels = (int)(sizeof(kernels) / sizeof(kernels[0]));
+    if (json) printf("{\"boards\": %d, \"runs\": %d, \"kernels\": [\n", N_BOARDS, runs);
+    else printf("%-22s %12s %12s %12s   (%d boards x %d runs)\n", "kernel", "median ns", "p99 ns",
+                "min ns", N_BOARDS, runs);
+
+    for (int k = 0; k < n_kernels; k++) {
+        for (int i = 0; i < WARMUP_RUNS; i++) kernels[k].run();
+        for (int r = 0; r < runs; r++) {
+            uint64_t t0 = now_ns();
+            kernels[k].run();
+            times[r] = now_ns() - t0;
+        }
+        qsort(times, runs, sizeof(uint64_t), compare_u64);
+
+        // Temps par appel (un passage = N_BOARDS appels)
+        double median = (double)times[runs / 2] / N_BOARDS;
+        double p99 = (double)times[(runs * 99) / 100 < runs ? (runs * 99) / 100 : runs - 1] / N_BOARDS;
+        double best = (double)times[0] / N_BOARDS;
+
+        if (json) {
+            printf("  {\"name\": \"%s\", \"median_ns\": %.2f, \"p99_ns\": %.2f, \"min_ns\": %.2f}%s\n",
+                   kernels[k].name, median, p99, best, (k < n_kernels - 1) ? "," : "");
+        } else {
+            printf("%-22s %12.2f %12.2f %12.2f\n", kernels[k].name, median, p99, best);
+        }
+    }
+    if (json) printf("]}\n");
+
+    free(times);
+    tt_cleanup();
+    return 0;
+}
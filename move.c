@@ -56,10 +56,9 @@ int valid_move(const Board *b, int h, Color c, int p){
             count = b->holes[h].blue;
             break;
         case T_AS_RED:
-            count = b->holes[h].transparent + b->holes[h].red;
-            break;
         case T_AS_BLUE:
-            count = b->holes[h].transparent + b->holes[h].blue;
+            // TR/TB exigent au moins une transparente (comme l'arbitre Java)
+            count = b->holes[h].transparent;
             break;
     }
     
@@ -0,0 +1,114 @@
+#define _GNU_SOURCE
+#include "perf_counters.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char* counter_names[PERF_COUNTERS] = {
+    "cycles", "instructions", "L1d-misses", "LLC-misses", "branch-misses", "dTLB-misses"
+};
+
+#ifdef __linux__
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static int counter_fd[PERF_COUNTERS] = {-1, -1, -1, -1, -1, -1};
+
+static uint64_t cache_config(uint64_t cache, uint64_t result) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (result << 16);
+}
+
+static int open_counter(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // pid = 0, cpu = -1 : ce processus (tous ses threads créés ensuite), sur n'importe quel CPU
+    attr.inherit = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+bool perf_init(void) {
+    counter_fd[PERF_CYCLES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    counter_fd[PERF_INSTRUCTIONS] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    counter_fd[PERF_L1D_MISSES] = open_counter(PERF_TYPE_HW_CACHE,
+        cache_config(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_RESULT_MISS));
+    counter_fd[PERF_LLC_MISSES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    counter_fd[PERF_BRANCH_MISSES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    counter_fd[PERF_DTLB_MISSES] = open_counter(PERF_TYPE_HW_CACHE,
+        cache_config(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_RESULT_MISS));
+
+    bool any = false;
+    for (int i = 0; i < PERF_COUNTERS; i++) any |= (counter_fd[i] >= 0);
+    return any;
+}
+
+void perf_start(void) {
+    for (int i = 0; i < PERF_COUNTERS; i++) {
+        if (counter_fd[i] < 0) continue;
+        ioctl(counter_fd[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(counter_fd[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+void perf_stop(PerfSample* sample) {
+    for (int i = 0; i < PERF_COUNTERS; i++) {
+        sample->valid[i] = false;
+        sample->value[i] = 0;
+        if (counter_fd[i] < 0) continue;
+        ioctl(counter_fd[i], PERF_EVENT_IOC_DISABLE, 0);
+        uint64_t value;
+        if (read(counter_fd[i], &value, sizeof(value)) == (ssize_t)sizeof(value)) {
+            sample->value[i] = value;
+            sample->valid[i] = true;
+        }
+    }
+}
+
+void perf_close(void) {
+    for (int i = 0; i < PERF_COUNTERS; i++) {
+        if (counter_fd[i] >= 0) close(counter_fd[i]);
+        counter_fd[i] = -1;
+    }
+}
+
+#else
+
+// Pas de perf_event_open hors Linux : compteurs toujours indisponibles
+bool perf_init(void) { return false; }
+void perf_start(void) {}
+void perf_stop(PerfSample* sample) { memset(sample, 0, sizeof(*sample)); }
+void perf_close(void) {}
+
+#endif // __linux__
+
+// Affiche les compteurs, en total et par noeud
+void perf_print(const char* label, const PerfSample* sample, uint64_t nodes) {
+    bool any = false;
+    for (int i = 0; i < PERF_COUNTERS; i++) any |= sample->valid[i];
+    if (!any) {
+        printf("%s: hardware counters unavailable\n", label);
+        return;
+    }
+
+    printf("%s:\n", label);
+    for (int i = 0; i < PERF_COUNTERS; i++) {
+        if (!sample->valid[i]) {
+            printf("  %-14s %16s\n", counter_names[i], "n/a");
+            continue;
+        }
+        printf("  %-14s %16llu  %10.2f /node\n", counter_names[i],
+               (unsigned long long)sample->value[i],
+               nodes ? (double)sample->value[i] / (double)nodes : 0.0);
+    }
+    if (sample->valid[PERF_CYCLES] && sample->valid[PERF_INSTRUCTIONS] && sample->value[PERF_CYCLES]) {
+        printf("  %-14s %16.2f\n", "IPC",
+               (double)sample->value[PERF_INSTRUCTIONS] / (double)sample->value[PERF_CYCLES]);
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// COMPTEURS MATÉRIELS (Linux, perf_event_open)
+// Utilisés par le benchmark pour savoir si un changement gagne en cache ou en
+// prédiction de branchement. Si les compteurs ne sont pas disponibles
+// (conteneur, Windows, perf_event_paranoid...), tout est simplement ignoré.
+
+typedef enum {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,
+    PERF_LLC_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_DTLB_MISSES,
+    PERF_COUNTERS
+} PerfCounter;
+
+typedef struct {
+    uint64_t value[PERF_COUNTERS];
+    bool valid[PERF_COUNTERS];
+} PerfSample;
+
+bool perf_init(void);    // true si au moins un compteur est disponible
+void perf_start(void);
+void perf_stop(PerfSample* sample);
+void perf_print(const char* label, const PerfSample* sample, uint64_t nodes);
+void perf_close(void);
+
+#endif // PERF_COUNTERS_H
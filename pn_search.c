@@ -0,0 +1,228 @@
+#include "pn_search.h"
+#include <string.h>
+#include <time.h>
+
+// Nombres de preuve / réfutation "infinis" (sommes saturées)
+#define PN_INF 100000000u
+
+// Table propre au solveur : 16 octets par entrée, 4 Mo
+#define PN_TABLE_SIZE (1 << 18)
+
+typedef struct {
+    uint64_t key;
+    uint32_t pn;
+    uint32_t dn;
+} PnEntry;
+
+PnConfig pn_config = {6, 10, 25, 200000};
+
+static PnEntry pn_table[PN_TABLE_SIZE];
+
+// État d'une résolution
+static struct {
+    int attacker;           // Joueur dont on prouve la victoire
+    uint64_t nodes;
+    uint64_t max_nodes;
+    bool use_time;
+    clock_t end_time;
+    volatile bool* stop;
+    bool aborted;
+} pn;
+
+
+// OUTILS
+
+
+static inline uint32_t pn_add(uint32_t a, uint32_t b) {
+    uint32_t s = a + b;
+    return (s >= PN_INF || s < a) ? PN_INF : s;
+}
+
+// La limite des 400 coups fait dépendre le résultat du nombre de coups joués : il entre dans la clé
+static inline uint64_t pn_key(const GameState* g) {
+    uint64_t key = zobrist_hash(&g->board, g->current, g->score);
+    key ^= (uint64_t)g->total_moves * 0x9E3779B97F4A7C15ULL;
+    return (pn.attacker == 1) ? key : ~key;
+}
+
+static inline void pn_lookup(uint64_t key, uint32_t* p, uint32_t* d) {
+    const PnEntry* e = &pn_table[key & (PN_TABLE_SIZE - 1)];
+    if (e->key == key) {
+        *p = e->pn;
+        *d = e->dn;
+    } else {
+        *p = 1;
+        *d = 1;
+    }
+}
+
+static inline void pn_store(uint64_t key, uint32_t p, uint32_t d) {
+    PnEntry* e = &pn_table[key & (PN_TABLE_SIZE - 1)];
+    e->key = key;
+    e->pn = p;
+    e->dn = d;
+}
+
+// Fin de partie : gagné si l'attaquant a strictement plus de graines
+static inline void pn_terminal(const GameState* g, uint32_t* p, uint32_t* d) {
+    int defender = (pn.attacker == 1) ? 2 : 1;
+    if (g->score[pn.attacker] > g->score[defender]) {
+        *p = 0;
+        *d = PN_INF;
+    } else {
+        *p = PN_INF;
+        *d = 0;
+    }
+}
+
+static inline bool pn_out_of_budget(void) {
+    if ((pn.nodes & 1023) == 0) {
+        if ((pn.max_nodes && pn.nodes >= pn.max_nodes) || (pn.use_time && clock() >= pn.end_time) ||
+            (pn.stop && *pn.stop)) {
+            pn.aborted = true;
+        }
+    }
+    return pn.aborted;
+}
+
+
+// DF-PN
+// Noeud OU (attaquant au trait) : pn = min des fils, dn = somme des fils.
+// Noeud ET (défenseur au trait) : pn = somme des fils, dn = min des fils.
+// On descend dans le fils le plus prometteur tant que (pn, dn) restent sous les seuils.
+
+
+static void pn_mid(const GameState* g, uint32_t th_pn, uint32_t th_dn, int ply, uint32_t* out_pn,
+                   uint32_t* out_dn) {
+    pn.nodes++;
+    uint64_t key = pn_key(g);
+
+    AIMove moves[64];
+    int n = game_over(g) ? 0 : generate_legal_moves(&g->board, g->current, moves);
+    if (n == 0) {
+        pn_terminal(g, out_pn, out_dn);
+        pn_store(key, *out_pn, *out_dn);
+        return;
+    }
+    if (ply >= PN_MAX_PLY) {
+        // Horizon atteint : compté comme non prouvé, et rangé pour que le parent
+        // ne redescende pas indéfiniment dans ce fils (il y lirait encore (1, 1))
+        *out_pn = PN_INF;
+        *out_dn = 0;
+        pn_store(key, *out_pn, *out_dn);
+        return;
+    }
+
+    // Clés des fils (les fins de partie sont évaluées tout de suite)
+    uint64_t keys[64];
+    for (int i = 0; i < n; i++) {
+        GameState child = *g;
+        apply_move(&child, moves[i]);
+        keys[i] = pn_key(&child);
+        if (game_over(&child)) {
+            uint32_t p, d;
+            pn_terminal(&child, &p, &d);
+            pn_store(keys[i], p, d);
+        }
+    }
+
+    bool or_node = (g->current == pn.attacker);
+    uint32_t node_pn = 0, node_dn = 0;
+
+    while (!pn_out_of_budget()) {
+        // (pn, dn) du noeud, meilleur fils et deuxième valeur pour le seuil
+        uint32_t best = PN_INF + 1, second = PN_INF, sum = 0;
+        int best_index = 0;
+        uint32_t best_pn = 0, best_dn = 0;
+        for (int i = 0; i < n; i++) {
+            uint32_t p, d;
+            pn_lookup(keys[i], &p, &d);
+            uint32_t select = or_node ? p : d;   // Le min qui fait la valeur du noeud
+            uint32_t other = or_node ? d : p;    // La somme
+            sum = pn_add(sum, other);
+            if (select < best) {
+                second = best;
+                best = select;
+                best_index = i;
+                best_pn = p;
+                best_dn = d;
+            } else if (select < second) {
+                second = select;
+            }
+        }
+        if (second > PN_INF) second = PN_INF;
+        node_pn = or_node ? best : sum;
+        node_dn = or_node ? sum : best;
+
+        if (node_pn >= th_pn || node_dn >= th_dn) break;
+
+        // Seuils du fils choisi
+        uint32_t child_th_pn, child_th_dn;
+        if (or_node) {
+            child_th_pn = (th_pn < pn_add(second, 1)) ? th_pn : pn_add(second, 1);
+            child_th_dn = pn_add(th_dn - node_dn, best_dn);
+        } else {
+            child_th_dn = (th_dn < pn_add(second, 1)) ? th_dn : pn_add(second, 1);
+            child_th_pn = pn_add(th_pn - node_pn, best_pn);
+        }
+
+        GameState child = *g;
+        apply_move(&child, moves[best_index]);
+        uint32_t p, d;
+        pn_mid(&child, child_th_pn, child_th_dn, ply + 1, &p, &d);
+    }
+
+    *out_pn = node_pn;
+    *out_dn = node_dn;
+    if (!pn.aborted) pn_store(key, node_pn, node_dn);
+}
+
+
+// POINTS D'ENTRÉE
+
+
+bool pn_should_solve(const GameState* g) {
+    if (pn_config.slice_percent <= 0 || game_over(g)) return false;
+    int top = (g->score[1] > g->score[2]) ? g->score[1] : g->score[2];
+    int on_board = board_total_seeds(&g->board);
+    return top >= 49 - pn_config.score_distance || on_board <= 10 + pn_config.seed_distance;
+}
+
+PnResult pn_solve(const GameState* game, uint64_t max_nodes, int time_ms, volatile bool* stop,
+                  AIMove* best_move, uint64_t* nodes) {
+    pn.attacker = game->current;
+    pn.nodes = 0;
+    pn.max_nodes = max_nodes;
+    pn.use_time = (time_ms > 0);
+    pn.end_time = clock() + ((clock_t)time_ms * CLOCKS_PER_SEC) / 1000;
+    pn.stop = stop;
+    pn.aborted = false;
+
+    uint32_t root_pn, root_dn;
+    pn_mid(game, PN_INF, PN_INF, 0, &root_pn, &root_dn);
+    if (nodes) *nodes = pn.nodes;
+
+    if (root_pn == 0) {
+        // Le coup gagnant : un fils prouvé
+        AIMove moves[64];
+        int n = generate_legal_moves(&game->board, game->current, moves);
+        for (int i = 0; i < n; i++) {
+            GameState child = *game;
+            apply_move(&child, moves[i]);
+            uint32_t p, d;
+            if (game_over(&child)) pn_terminal(&child, &p, &d);
+            else pn_lookup(pn_key(&child), &p, &d);
+            if (p == 0) {
+                *best_move = moves[i];
+                return PN_WIN;
+            }
+        }
+        return PN_UNKNOWN; // Fils prouvé écrasé dans la table entre-temps
+    }
+    if (root_dn == 0 && !pn.aborted) return PN_NO_WIN;
+    return PN_UNKNOWN;
+}
+
+void pn_clear(void) {
+    memset(pn_table, 0, sizeof(pn_table));
+}
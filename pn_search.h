@@ -0,0 +1,39 @@
+#ifndef PN_SEARCH_H
+#define PN_SEARCH_H
+
+#include "ai.h"
+#include "game.h"
+
+// SOLVEUR DE FIN DE PARTIE (df-pn, proof-number en profondeur d'abord)
+// Cherche à prouver que le joueur au trait peut forcer la victoire (plus de graines
+// que l'adversaire à la fin). Déclenché près du seuil des 49 graines ou quand il reste
+// peu de graines sur le plateau, avec une part bornée du temps du coup.
+
+// Horizon du solveur en demi-coups. Au-delà, le noeud est compté comme non gagné : les
+// preuves restent exactes, seules les réfutations deviennent approximatives
+#define PN_MAX_PLY 200
+
+typedef enum {
+    PN_UNKNOWN,   // Budget épuisé
+    PN_WIN,       // Victoire forcée prouvée (best_move la garantit)
+    PN_NO_WIN     // Pas de victoire forcée dans l'horizon du solveur
+} PnResult;
+
+typedef struct {
+    int score_distance;     // Déclenché si un joueur a au moins 49 - score_distance graines
+    int seed_distance;      // ... ou s'il reste au plus 10 + seed_distance graines en jeu
+    int slice_percent;      // Part du temps (ou des noeuds) du coup donnée au solveur
+    uint64_t max_nodes;     // Budget en noeuds quand la recherche n'a aucune limite (temps, noeuds, profondeur)
+} PnConfig;
+
+extern PnConfig pn_config;
+
+bool pn_should_solve(const GameState* game);
+
+// time_ms <= 0 : pas de limite de temps (seulement max_nodes et stop)
+PnResult pn_solve(const GameState* game, uint64_t max_nodes, int time_ms, volatile bool* stop,
+                  AIMove* best_move, uint64_t* nodes);
+
+void pn_clear(void);
+
+#endif // PN_SEARCH_H
@@ -0,0 +1,69 @@
+#include "profiler.h"
+
+#ifdef PROFILE
+
+#include <stdio.h>
+#include <string.h>
+
+static const char* phase_names[PROF_PHASES] = {
+    "evaluate", "movegen", "sort", "tt_probe", "tt_store", "apply_move"
+};
+
+// Compteurs par profondeur d'itération (iterative deepening) et par phase
+static uint64_t prof_calls[PROF_MAX_DEPTH][PROF_PHASES];
+static uint64_t prof_total[PROF_MAX_DEPTH][PROF_PHASES];
+static int prof_depth = 0;
+static uint64_t prof_search_start = 0;
+
+void prof_reset(void) {
+    memset(prof_calls, 0, sizeof(prof_calls));
+    memset(prof_total, 0, sizeof(prof_total));
+    prof_depth = 0;
+    prof_search_start = prof_cycles();
+}
+
+void prof_set_depth(int depth) {
+    prof_depth = (depth < PROF_MAX_DEPTH) ? depth : PROF_MAX_DEPTH - 1;
+}
+
+void prof_record(ProfPhase phase, uint64_t cycles) {
+    prof_calls[prof_depth][phase]++;
+    prof_total[prof_depth][phase] += cycles;
+}
+
+// Tableau récapitulatif après chaque coup (sur stderr pour ne pas gêner l'arbitre)
+void prof_report(void) {
+    uint64_t search_cycles = prof_cycles() - prof_search_start;
+    if (search_cycles == 0) search_cycles = 1;
+
+    fprintf(stderr, "\n=== PROFIL (cycles TSC, %llu au total) ===\n", (unsigned long long)search_cycles);
+    fprintf(stderr, "depth");
+    for (int p = 0; p < PROF_PHASES; p++) fprintf(stderr, " %12s", phase_names[p]);
+    fprintf(stderr, "   (kcycles)\n");
+
+    uint64_t calls[PROF_PHASES] = {0};
+    uint64_t total[PROF_PHASES] = {0};
+    for (int d = 0; d < PROF_MAX_DEPTH; d++) {
+        int used = 0;
+        for (int p = 0; p < PROF_PHASES; p++) used |= (prof_calls[d][p] != 0);
+        if (!used) continue;
+
+        fprintf(stderr, "%5d", d);
+        for (int p = 0; p < PROF_PHASES; p++) {
+            fprintf(stderr, " %12llu", (unsigned long long)(prof_total[d][p] / 1000));
+            calls[p] += prof_calls[d][p];
+            total[p] += prof_total[d][p];
+        }
+        fprintf(stderr, "\n");
+    }
+
+    fprintf(stderr, "%-12s %12s %14s %10s %6s\n", "phase", "calls", "cycles", "cyc/call", "%");
+    for (int p = 0; p < PROF_PHASES; p++) {
+        fprintf(stderr, "%-12s %12llu %14llu %10llu %5.1f%%\n", phase_names[p],
+                (unsigned long long)calls[p], (unsigned long long)total[p],
+                (unsigned long long)(calls[p] ? total[p] / calls[p] : 0),
+                100.0 * (double)total[p] / (double)search_cycles);
+    }
+}
+
+#endif // PROFILE
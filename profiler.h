@@ -0,0 +1,56 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+// PROFILAGE DE LA RECHERCHE PAR PHASE
+// Activé seulement à la compilation avec -DPROFILE (make PROFILE=1).
+// Sinon toutes les macros disparaissent : aucun coût dans le binaire du tournoi.
+
+typedef enum {
+    PROF_EVALUATE,   // evaluate() (inclut ses propres générations de coups)
+    PROF_MOVEGEN,    // generate_legal_moves() dans negamax
+    PROF_SORT,       // sort_moves()
+    PROF_TT_PROBE,   // tt_probe()
+    PROF_TT_STORE,   // tt_store()
+    PROF_APPLY,      // apply_move() -> sow_and_capture()
+    PROF_PHASES
+} ProfPhase;
+
+#define PROF_MAX_DEPTH 32
+
+#ifdef PROFILE
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static inline uint64_t prof_cycles(void) { return __rdtsc(); }
+#else
+#include <time.h>
+static inline uint64_t prof_cycles(void) { return (uint64_t)clock(); }
+#endif
+
+void prof_reset(void);
+void prof_set_depth(int depth);
+void prof_record(ProfPhase phase, uint64_t cycles);
+void prof_report(void);
+
+// Exécute "stmt" en comptant ses cycles dans la phase donnée
+#define PROF(phase, stmt) do { \
+        uint64_t prof_t0_ = prof_cycles(); \
+        stmt; \
+        prof_record(phase, prof_cycles() - prof_t0_); \
+    } while (0)
+#define PROF_RESET()      prof_reset()
+#define PROF_DEPTH(d)     prof_set_depth(d)
+#define PROF_REPORT()     prof_report()
+
+#else
+
+#define PROF(phase, stmt) do { stmt; } while (0)
+#define PROF_RESET()      ((void)0)
+#define PROF_DEPTH(d)     ((void)0)
+#define PROF_REPORT()     ((void)0)
+
+#endif // PROFILE
+
+#endif // PROFILER_H
@@ -0,0 +1,266 @@
+// Génération de données par self-play
+// Chaque position jouée est écrite dans un fichier binaire (selfplay_record.h) avec le score
+// de la recherche, le meilleur coup et le résultat final de la partie.
+// Usage : selfplay.exe gen <fichier> [games N] [depth D] [nodes N] [jobs J] [random R] [seed S]
+//                                [params fichier]  (poids de l'évaluation, cf. tune.c)
+//         selfplay.exe read <fichier> [shuffle]   (parcourt le fichier, débit en Mo/s)
+//         selfplay.exe dump <fichier> [n]         (affiche les n premières positions)
+#define _POSIX_C_SOURCE 200112L
+#include "ai.h"
+#include "ai_interface.h"
+#include "eval_params.h"
+#include "game.h"
+#include "selfplay_record.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#define DEFAULT_GAMES 100
+#define DEFAULT_DEPTH 6
+#define DEFAULT_RANDOM_PLIES 6
+#define MAX_JOBS 64
+#define MAX_GAME_RECORDS 512
+
+typedef struct {
+    int games;
+    int depth;
+    uint64_t nodes;
+    int jobs;
+    int random_plies;
+    uint64_t seed;
+} GenOptions;
+
+static uint64_t now_us(void) {
+#ifdef _WIN32
+    return (uint64_t)GetTickCount64() * 1000;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+#endif
+}
+
+static uint64_t rng_next(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+
+// GÉNÉRATION
+
+
+// Une partie : ouverture au hasard (pour varier les parties) puis recherche à chaque coup.
+// Les coups forcés ne sont pas enregistrés (la recherche ne donne pas de score).
+static int play_game(const GenOptions* opt, uint64_t* rng, SelfPlayRecord* recs) {
+    GameState game;
+    game_init(&game);
+    AI_Advanced.new_game();
+
+    AIMove moves[64];
+    for (int i = 0; i < opt->random_plies && !game_over(&game); i++) {
+        int n = generate_legal_moves(&game.board, game.current, moves);
+        if (n == 0) break;
+        apply_move(&game, moves[rng_next(rng) % n]);
+    }
+
+    SearchLimits limits = {0};
+    limits.depth = opt->depth;
+    limits.nodes = opt->nodes;
+
+    int count = 0;
+    while (!game_over(&game)) {
+        int n = generate_legal_moves(&game.board, game.current, moves);
+        if (n == 0) break;
+        if (n == 1) {
+            apply_move(&game, moves[0]);
+            continue;
+        }
+        AIMove best = moves[0];
+        int score = AI_Advanced.search(&game, &limits, &best);
+        if (best.hole == 0) break;
+        if (count < MAX_GAME_RECORDS) record_pack(&recs[count++], &game, score, best);
+        apply_move(&game, best);
+    }
+
+    // Résultat final vu par le joueur au trait de chaque position
+    int winner = get_game_result(&game);
+    for (int i = 0; i < count; i++) {
+        recs[i].result = (int8_t)((winner == 0) ? 0 : (winner == recs[i].side ? 1 : -1));
+    }
+    return count;
+}
+
+static int run_job(const char* path, const GenOptions* opt, int job, int games) {
+    // Écriture non bufferisée en fin de fichier : une partie = un seul write,
+    // les processus ne mélangent pas leurs enregistrements
+    FILE* f = fopen(path, "ab");
+    if (!f) return 1;
+    setvbuf(f, NULL, _IONBF, 0);
+
+    tt_init();
+    AI_Advanced.init();
+    uint64_t rng = opt->seed + 0x9E3779B97F4A7C15ULL * (uint64_t)(job + 1);
+    static SelfPlayRecord recs[MAX_GAME_RECORDS];
+
+    long positions = 0;
+    for (int g = 0; g < games; g++) {
+        int count = play_game(opt, &rng, recs);
+        if (fwrite(recs, sizeof(SelfPlayRecord), (size_t)count, f) != (size_t)count) {
+            fclose(f);
+            return 1;
+        }
+        positions += count;
+    }
+    fprintf(stderr, "job %d: %d parties, %ld positions\n", job, games, positions);
+
+    AI_Advanced.cleanup();
+    tt_cleanup();
+    fclose(f);
+    return 0;
+}
+
+static int generate(const char* path, const GenOptions* opt) {
+    // En-tête écrit une seule fois (nouveau fichier) : sinon on ajoute à la suite
+    FILE* f = fopen(path, "ab");
+    if (!f) {
+        fprintf(stderr, "Impossible d'ouvrir %s\n", path);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    if (ftell(f) == 0) {
+        RecordFileHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, RECORD_MAGIC, sizeof(RECORD_MAGIC));
+        header.version = RECORD_VERSION;
+        header.record_size = sizeof(SelfPlayRecord);
+        fwrite(&header, sizeof(header), 1, f);
+    }
+    fclose(f);
+
+    uint64_t start = now_us();
+    int ret = 0;
+#ifndef _WIN32
+    // Un processus par job : la recherche utilise des tables globales
+    pid_t pids[MAX_JOBS];
+    int started = 0;
+    for (int j = 0; j < opt->jobs; j++) {
+        int games = opt->games / opt->jobs + (j < opt->games % opt->jobs);
+        pid_t pid = fork();
+        if (pid == 0) _exit(run_job(path, opt, j, games));
+        if (pid > 0) pids[started++] = pid;
+    }
+    for (int j = 0; j < started; j++) {
+        int status;
+        if (waitpid(pids[j], &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) ret = 1;
+    }
+#else
+    ret = run_job(path, opt, 0, opt->games);
+#endif
+    printf("%d parties en %.1f s -> %s\n", opt->games, (now_us() - start) / 1e6, path);
+    return ret;
+}
+
+
+// LECTURE
+
+
+static int read_file(const char* path, bool shuffle) {
+    RecordReader reader;
+    if (!record_reader_open(&reader, path)) {
+        fprintf(stderr, "Fichier invalide: %s\n", path);
+        return 1;
+    }
+    if (shuffle) record_reader_shuffle(&reader, now_us());
+
+    uint64_t start = now_us();
+    long results[3] = {0, 0, 0};
+    uint64_t checksum = 0;
+    for (size_t i = 0; i < reader.count; i++) {
+        const SelfPlayRecord* rec = record_reader_get(&reader, i);
+        results[rec->result + 1]++;
+        checksum += (uint64_t)rec->search_score + rec->seeds[0][0];
+    }
+    uint64_t us = now_us() - start;
+    double mb = (double)reader.count * sizeof(SelfPlayRecord) / (1024.0 * 1024.0);
+
+    printf("%zu positions (%s) : %ld gagnées, %ld nulles, %ld perdues (checksum %llu)\n",
+           reader.count, shuffle ? "mélangées" : "ordre du fichier", results[2], results[1],
+           results[0], (unsigned long long)checksum);
+    printf("Lecture : %.1f ms, %.0f Mo/s\n", us / 1000.0, us ? mb * 1e6 / us : 0.0);
+    record_reader_close(&reader);
+    return 0;
+}
+
+static int dump_file(const char* path, long n) {
+    RecordReader reader;
+    if (!record_reader_open(&reader, path)) {
+        fprintf(stderr, "Fichier invalide: %s\n", path);
+        return 1;
+    }
+    for (size_t i = 0; i < reader.count && (long)i < n; i++) {
+        const SelfPlayRecord* rec = record_reader_get(&reader, i);
+        GameState game;
+        char buf[256];
+        record_unpack(rec, &game);
+        game_to_string(&game, buf, sizeof(buf));
+        AIMove best = record_best_move(rec);
+        printf("%s | %d%s %d %d\n", buf, best.hole, color_to_string(best.color),
+               rec->search_score, rec->result);
+    }
+    record_reader_close(&reader);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s gen|read|dump <fichier> [options]\n", argv[0]);
+        return 1;
+    }
+    const char* path = argv[2];
+
+    if (strcmp(argv[1], "read") == 0) {
+        return read_file(path, argc > 3 && strcmp(argv[3], "shuffle") == 0);
+    }
+    if (strcmp(argv[1], "dump") == 0) {
+        return dump_file(path, (argc > 3) ? atol(argv[3]) : 10);
+    }
+    if (strcmp(argv[1], "gen") != 0) {
+        fprintf(stderr, "Mode inconnu: %s\n", argv[1]);
+        return 1;
+    }
+
+    GenOptions opt = {DEFAULT_GAMES, DEFAULT_DEPTH, 0, 1, DEFAULT_RANDOM_PLIES, 1};
+    bool depth_given = false;
+    for (int i = 3; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "games") == 0) opt.games = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "depth") == 0) {
+            opt.depth = atoi(argv[i + 1]);
+            depth_given = true;
+        }
+        else if (strcmp(argv[i], "nodes") == 0) opt.nodes = strtoull(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "jobs") == 0) opt.jobs = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "random") == 0) opt.random_plies = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "seed") == 0) opt.seed = strtoull(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "params") == 0 && !eval_params_load(argv[i + 1])) {
+            fprintf(stderr, "Poids illisibles: %s\n", argv[i + 1]);
+            return 1;
+        }
+    }
+    // Limite en noeuds seule : pas de limite de profondeur
+    if (opt.nodes > 0 && !depth_given) opt.depth = 0;
+    if (opt.jobs < 1) opt.jobs = 1;
+    if (opt.jobs > MAX_JOBS) opt.jobs = MAX_JOBS;
+    return generate(path, &opt);
+}
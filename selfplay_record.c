@@ -0,0 +1,144 @@
+#define _POSIX_C_SOURCE 200112L
+#include "selfplay_record.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Le format est figé : on vérifie la taille à la compilation
+typedef char record_size_check[(sizeof(SelfPlayRecord) == 64) ? 1 : -1];
+typedef char header_size_check[(sizeof(RecordFileHeader) == 16) ? 1 : -1];
+
+
+// CODAGE D'UNE POSITION
+
+
+void record_pack(SelfPlayRecord* rec, const GameState* game, int search_score, AIMove best) {
+    memset(rec, 0, sizeof(SelfPlayRecord));
+    for (int i = 0; i < N_HOLES; i++) {
+        rec->seeds[i][0] = (uint8_t)game->board.holes[i].red;
+        rec->seeds[i][1] = (uint8_t)game->board.holes[i].blue;
+        rec->seeds[i][2] = (uint8_t)game->board.holes[i].transparent;
+    }
+    rec->side = (uint8_t)game->current;
+    rec->score[0] = (uint8_t)game->score[1];
+    rec->score[1] = (uint8_t)game->score[2];
+    rec->best_move = (uint8_t)((best.hole << 2) | (best.color & 3));
+    rec->search_score = search_score;
+    rec->half_moves = (uint16_t)game->half_moves_without_capture;
+    rec->total_moves = (uint16_t)game->total_moves;
+}
+
+void record_unpack(const SelfPlayRecord* rec, GameState* game) {
+    memset(game, 0, sizeof(GameState));
+    for (int i = 0; i < N_HOLES; i++) {
+        game->board.holes[i].red = rec->seeds[i][0];
+        game->board.holes[i].blue = rec->seeds[i][1];
+        game->board.holes[i].transparent = rec->seeds[i][2];
+    }
+    game->current = rec->side;
+    game->score[1] = rec->score[0];
+    game->score[2] = rec->score[1];
+    game->half_moves_without_capture = rec->half_moves;
+    game->total_moves = rec->total_moves;
+}
+
+AIMove record_best_move(const SelfPlayRecord* rec) {
+    AIMove move;
+    move.hole = rec->best_move >> 2;
+    move.color = (Color)(rec->best_move & 3);
+    return move;
+}
+
+
+// LECTURE
+
+
+static int header_valid(const RecordFileHeader* h) {
+    return memcmp(h->magic, RECORD_MAGIC, sizeof(RECORD_MAGIC)) == 0 &&
+           h->version == RECORD_VERSION && h->record_size == sizeof(SelfPlayRecord);
+}
+
+int record_reader_open(RecordReader* reader, const char* path) {
+    memset(reader, 0, sizeof(RecordReader));
+
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 0;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(RecordFileHeader)) {
+        close(fd);
+        return 0;
+    }
+    void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // La projection reste valide
+    if (map == MAP_FAILED) return 0;
+    posix_madvise(map, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+    reader->data = map;
+    reader->size = (size_t)st.st_size;
+    reader->mapped = 1;
+#else
+    // Pas de mmap : on charge tout le fichier
+    FILE* f = fopen(path, "rb");
+    if (!f) return 0;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size < (long)sizeof(RecordFileHeader)) {
+        fclose(f);
+        return 0;
+    }
+    reader->data = malloc((size_t)size);
+    if (!reader->data || fread(reader->data, 1, (size_t)size, f) != (size_t)size) {
+        free(reader->data);
+        fclose(f);
+        return 0;
+    }
+    fclose(f);
+    reader->size = (size_t)size;
+#endif
+
+    if (!header_valid((const RecordFileHeader*)reader->data)) {
+        record_reader_close(reader);
+        return 0;
+    }
+    reader->records = (const SelfPlayRecord*)((const char*)reader->data + sizeof(RecordFileHeader));
+    reader->count = (reader->size - sizeof(RecordFileHeader)) / sizeof(SelfPlayRecord);
+    return 1;
+}
+
+// Fisher-Yates sur les indices (les enregistrements ne bougent pas)
+void record_reader_shuffle(RecordReader* reader, uint64_t seed) {
+    if (!reader->order) {
+        reader->order = (uint32_t*)malloc(sizeof(uint32_t) * (reader->count ? reader->count : 1));
+        if (!reader->order) return;
+    }
+    for (size_t i = 0; i < reader->count; i++) reader->order[i] = (uint32_t)i;
+
+    uint64_t x = seed ? seed : 0x9E3779B97F4A7C15ULL;
+    for (size_t i = reader->count; i > 1; i--) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        size_t j = (size_t)(x % i);
+        uint32_t tmp = reader->order[i - 1];
+        reader->order[i - 1] = reader->order[j];
+        reader->order[j] = tmp;
+    }
+}
+
+void record_reader_close(RecordReader* reader) {
+#ifndef _WIN32
+    if (reader->mapped && reader->data) munmap(reader->data, reader->size);
+#else
+    free(reader->data);
+#endif
+    free(reader->order);
+    memset(reader, 0, sizeof(RecordReader));
+}
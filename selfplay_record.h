@@ -0,0 +1,59 @@
+#ifndef SELFPLAY_RECORD_H
+#define SELFPLAY_RECORD_H
+
+#include "ai.h"
+#include "game.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// FORMAT BINAIRE DES POSITIONS DE SELF-PLAY
+// Un fichier = un en-tête de 16 octets puis des enregistrements de 64 octets (petit-boutiste)
+
+#define RECORD_MAGIC "AWALESP"
+#define RECORD_VERSION 1
+
+typedef struct {
+    char magic[8];              // RECORD_MAGIC
+    uint32_t version;
+    uint32_t record_size;       // sizeof(SelfPlayRecord)
+} RecordFileHeader;
+
+typedef struct {
+    uint8_t seeds[N_HOLES][3];  // Rouges, bleues, transparentes par trou
+    uint8_t side;               // Joueur au trait (1 ou 2)
+    uint8_t score[2];           // Scores J1 et J2
+    uint8_t best_move;          // (trou 1..16) << 2 | couleur
+    int32_t search_score;       // Score de la recherche pour le joueur au trait
+    int8_t result;              // Résultat final pour le joueur au trait : 1, 0 ou -1
+    uint8_t reserved;
+    uint16_t half_moves;        // Coups sans capture
+    uint16_t total_moves;
+    uint16_t reserved2;
+} SelfPlayRecord;
+
+void record_pack(SelfPlayRecord* rec, const GameState* game, int search_score, AIMove best);
+void record_unpack(const SelfPlayRecord* rec, GameState* game);
+AIMove record_best_move(const SelfPlayRecord* rec);
+
+// LECTURE
+// Le fichier est projeté en mémoire (lecture séquentielle à la vitesse de la RAM) ;
+// record_reader_shuffle() fixe un ordre aléatoire de parcours sans copier les données
+
+typedef struct {
+    const SelfPlayRecord* records;
+    size_t count;
+    uint32_t* order;            // NULL = ordre du fichier
+    void* data;                 // Début du fichier (projection ou copie)
+    size_t size;
+    int mapped;
+} RecordReader;
+
+int  record_reader_open(RecordReader* reader, const char* path);
+void record_reader_shuffle(RecordReader* reader, uint64_t seed);
+void record_reader_close(RecordReader* reader);
+
+static inline const SelfPlayRecord* record_reader_get(const RecordReader* reader, size_t i) {
+    return &reader->records[reader->order ? reader->order[i] : i];
+}
+
+#endif // SELFPLAY_RECORD_H
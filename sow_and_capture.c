@@ -59,7 +59,9 @@ static int capture_hole(Board *b, int hole) {
 }
 
 // FONCTION PRINCIPALE : Joue un coup complet (Semis + Capture) 
-int sow_and_capture(Board *b, int start, Color c, int *score_gain, int player) {
+// Le corps est partagé par la version générique et les variantes _p1/_p2
+// (avec player constant, is_player_hole devient un simple test de parité)
+static FORCE_INLINE int sow_and_capture_side(Board *b, int start, Color c, int *score_gain, int player) {
     *score_gain = 0;
     
     // 1. On compte combien de graines on a en main
@@ -142,9 +144,21 @@ int sow_and_capture(Board *b, int start, Color c, int *score_gain, int player) {
     return 1;
 }
 
+int sow_and_capture(Board *b, int start, Color c, int *score_gain, int player) {
+    return sow_and_capture_side(b, start, c, score_gain, player);
+}
+
+int sow_and_capture_p1(Board *b, int start, Color c, int *score_gain) {
+    return sow_and_capture_side(b, start, c, score_gain, 1);
+}
+
+int sow_and_capture_p2(Board *b, int start, Color c, int *score_gain) {
+    return sow_and_capture_side(b, start, c, score_gain, 2);
+}
+
 // PRÉDICTION RAPIDE POUR L'IA
 // Simule le déplacement sans modifier le plateau pour savoir où on atterrit
-int quick_predict_score(const Board *b, int start, Color c, int player) {
+static FORCE_INLINE int quick_predict_side(const Board *b, int start, Color c, int player) {
     int red = 0, blue = 0, trans = 0;
     
     switch(c) {
@@ -199,4 +213,150 @@ int quick_predict_score(const Board *b, int start, Color c, int player) {
     }
     
     return 0;
-}
\ No newline at end of file
+}
+
+int quick_predict_score(const Board *b, int start, Color c, int player) {
+    return quick_predict_side(b, start, c, player);
+}
+
+int quick_predict_score_p1(const Board *b, int start, Color c) {
+    return quick_predict_side(b, start, c, 1);
+}
+
+int quick_predict_score_p2(const Board *b, int start, Color c) {
+    return quick_predict_side(b, start, c, 2);
+}
+
+// EXPANSION GROUPÉE
+// Tous les coups d'un noeud partent du même plateau et le trou de départ est toujours
+// dans le camp du joueur : les rouges parcourent les 15 autres trous, les bleues les 8 trous
+// adverses (décalages impairs). Le k-ième trou du cycle reçoit total / L + (k <= total % L)
+// graines, dont t / L + (k <= t % L) transparentes (semées en premier). Le gain se calcule
+// donc sans écrire de plateau : la rafle lit chaque trou comme "avant + graines reçues".
+
+// Graines reçues par le trou h (0 pour le départ et les trous sautés)
+static inline int sown_into(const SownMove *m, int h, int *trans) {
+    int offset = (h - m->start) & 15;
+    int rank = (m->cycle == 15) ? offset : ((offset & 1) ? (offset + 1) >> 1 : 0);
+    *trans = rank ? m->trans / m->cycle + (rank <= m->trans % m->cycle) : 0;
+    return rank ? m->total / m->cycle + (rank <= m->total % m->cycle) : 0;
+}
+
+static FORCE_INLINE void sow_closed_form(const Board *b, int start, Color c, SownMove *m) {
+    const Hole *src = &b->holes[start];
+    int red_cycle = (c == RED || c == T_AS_RED);
+    m->start = start;
+    m->color = c;
+    m->cycle = red_cycle ? 15 : 8;
+    m->trans = (c == T_AS_RED || c == T_AS_BLUE) ? src->transparent : 0;
+    m->total = m->trans + (red_cycle ? src->red : src->blue);
+    m->gain = 0;
+    m->landing = -1;
+    if (m->total == 0) return;
+
+    int last = (m->total - 1) % m->cycle + 1;
+    m->landing = red_cycle ? (start + last) & 15 : (start + 2 * last - 1) & 15;
+
+    // Rafle sur le plateau virtuel ; le départ garde ce qui n'a pas été joué
+    int left = get_total_seeds(b, start) - m->total;
+    int pos = m->landing;
+    for (int checked = 0; checked < N_HOLES; checked++) {
+        int t;
+        int seeds = (pos == start) ? left : get_total_seeds(b, pos) + sown_into(m, pos, &t);
+        if (seeds != 2 && seeds != 3) break;
+        m->gain += seeds;
+        pos = (pos + N_HOLES - 1) % N_HOLES;
+    }
+}
+
+void sow_moves(const Board *b, const int *starts, const Color *colors, int n, SownMove *out) {
+    for (int i = 0; i < n; i++) {
+        sow_closed_form(b, starts[i], colors[i], &out[i]);
+    }
+}
+
+void sow_apply(Board *b, const SownMove *m) {
+    if (m->landing < 0) return;
+    empty_source_hole(b, m->start, m->color);
+    int red_cycle = (m->cycle == 15);
+    if (m->total <= m->cycle) {
+        // Moins d'un tour : une graine par trou semé, transparentes d'abord
+        int step = red_cycle ? 1 : 2;
+        for (int rank = 1; rank <= m->total; rank++) {
+            Hole *hole = &b->holes[(m->start + step * rank - (step - 1)) & 15];
+            if (rank <= m->trans) hole->transparent++;
+            else if (red_cycle) hole->red++;
+            else hole->blue++;
+        }
+    } else {
+        for (int h = 0; h < N_HOLES; h++) {
+            int t;
+            int sown = sown_into(m, h, &t);
+            b->holes[h].transparent += t;
+            if (red_cycle) b->holes[h].red += sown - t;
+            else b->holes[h].blue += sown - t;
+        }
+    }
+    // La rafle déjà comptée dans gain : on vide les mêmes trous
+    int pos = m->landing, taken = 0;
+    while (taken < m->gain) {
+        taken += capture_hole(b, pos);
+        pos = (pos + N_HOLES - 1) % N_HOLES;
+    }
+}
+
+// ÉCHANGE STATIQUE (SEE)
+// Gain exact du coup (rafle comprise, semis sur une copie du plateau) moins la meilleure
+// reprise immédiate de l'adversaire. Chaque reprise est calculée exactement par la forme
+// close (plusieurs tours compris), sans copie de plateau ni descendre plus loin.
+static FORCE_INLINE int best_recapture_side(const Board *after, int opponent) {
+    int best = 0;
+    for (int h = opponent - 1; h < N_HOLES; h += 2) {
+        const Hole *hole = &after->holes[h];
+        Color colors[4];
+        int n = 0;
+        if (hole->red) colors[n++] = RED;
+        if (hole->blue) colors[n++] = BLUE;
+        if (hole->transparent) {
+            colors[n++] = T_AS_RED;
+            colors[n++] = T_AS_BLUE;
+        }
+        for (int k = 0; k < n; k++) {
+            SownMove reply;
+            sow_closed_form(after, h, colors[k], &reply);
+            if (reply.gain > best) best = reply.gain;
+        }
+    }
+    return best;
+}
+
+static FORCE_INLINE int static_exchange_side(const Board *b, int start, Color c, int player, int *gain) {
+    Board after = *b;
+    *gain = 0;
+    if (!sow_and_capture_side(&after, start, c, gain, player)) return 0;
+    return *gain - best_recapture_side(&after, (player == 1) ? 2 : 1);
+}
+
+int static_exchange(const Board *b, int start, Color c, int player, int *gain) {
+    return static_exchange_side(b, start, c, player, gain);
+}
+
+int static_exchange_p1(const Board *b, int start, Color c, int *gain) {
+    return static_exchange_side(b, start, c, 1, gain);
+}
+
+int static_exchange_p2(const Board *b, int start, Color c, int *gain) {
+    return static_exchange_side(b, start, c, 2, gain);
+}
+
+int best_recapture(const Board *after, int opponent) {
+    return best_recapture_side(after, opponent);
+}
+
+int best_recapture_p1(const Board *after) {
+    return best_recapture_side(after, 1);
+}
+
+int best_recapture_p2(const Board *after) {
+    return best_recapture_side(after, 2);
+}
@@ -33,4 +33,47 @@ int sow_and_capture(Board *b, int start, Color c, int *score_gain, int player);
  */
 int quick_predict_score(const Board *b, int start, Color c, int player);
 
+// Variantes spécialisées sur le joueur au trait (mêmes résultats, sans test de camp à l'exécution)
+int sow_and_capture_p1(Board *b, int start, Color c, int *score_gain);
+int sow_and_capture_p2(Board *b, int start, Color c, int *score_gain);
+int quick_predict_score_p1(const Board *b, int start, Color c);
+int quick_predict_score_p2(const Board *b, int start, Color c);
+
+/**
+ * Échange statique d'un coup, SANS modifier le plateau : gain exact du coup (rafle comprise)
+ * moins la meilleure capture que l'adversaire peut faire juste après.
+ *
+ * @param gain Pointeur pour stocker le gain exact du coup seul
+ * @return Le gain net (négatif si l'adversaire reprend plus qu'on ne prend)
+ */
+int static_exchange(const Board *b, int start, Color c, int player, int *gain);
+int static_exchange_p1(const Board *b, int start, Color c, int *gain);
+int static_exchange_p2(const Board *b, int start, Color c, int *gain);
+
+// Meilleure capture immédiate de opponent sur le plateau after (partie reprise de static_exchange)
+int best_recapture(const Board *after, int opponent);
+int best_recapture_p1(const Board *after);
+int best_recapture_p2(const Board *after);
+
+// Un coup analysé d'avance par l'expansion groupée (aucun plateau écrit)
+typedef struct {
+    int start;     // Trou de départ (0-15)
+    Color color;
+    int total;     // Graines semées, dont trans transparentes (semées en premier)
+    int trans;
+    int cycle;     // 15 (rouges : tous les autres trous) ou 8 (bleues : trous adverses)
+    int gain;      // Graines capturées (rafle exacte)
+    int landing;   // Trou de la dernière graine (-1 si le coup est vide)
+} SownMove;
+
+/**
+ * Analyse en une passe n coups partant du même plateau, sans le modifier
+ * (départ dans le camp du joueur au trait, comme pour tout coup légal) :
+ * gain exact et trou d'arrivée, calculés en forme fermée (graines reçues par trou).
+ */
+void sow_moves(const Board *b, const int *starts, const Color *colors, int n, SownMove *out);
+
+// Joue sur b un coup analysé par sow_moves sur ce même plateau (même résultat que sow_and_capture)
+void sow_apply(Board *b, const SownMove *m);
+
 #endif // SOW_AND_CAPTURE_H
@@ -0,0 +1,82 @@
+#include "trace.h"
+
+#ifdef TRACE
+
+#include <stdio.h>
+#include <string.h>
+
+// Les enregistrements sont regroupés en mémoire et écrits par blocs
+#define TRACE_BUFFER_RECORDS 4096
+
+typedef char trace_record_size_check[(sizeof(TraceRecord) == 32) ? 1 : -1];
+
+static FILE* trace_file = NULL;
+static TraceRecord trace_buffer[TRACE_BUFFER_RECORDS];
+static int trace_count = 0;
+static uint8_t trace_root_depth = 0;
+
+static void trace_flush(void) {
+    if (trace_file && trace_count > 0) fwrite(trace_buffer, sizeof(TraceRecord), trace_count, trace_file);
+    trace_count = 0;
+}
+
+bool trace_open(const char* path) {
+    trace_close();
+    trace_file = fopen(path, "wb");
+    if (!trace_file) return false;
+
+    // En-tête : magic, version, taille d'un enregistrement (16 octets)
+    char header[16] = {0};
+    uint32_t version = TRACE_VERSION, size = sizeof(TraceRecord);
+    memcpy(header, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    memcpy(header + 8, &version, 4);
+    memcpy(header + 12, &size, 4);
+    fwrite(header, sizeof(header), 1, trace_file);
+    return true;
+}
+
+void trace_close(void) {
+    if (!trace_file) return;
+    trace_flush();
+    fclose(trace_file);
+    trace_file = NULL;
+}
+
+void trace_write(const TraceRecord* rec) {
+    if (!trace_file) return;
+    trace_buffer[trace_count++] = *rec;
+    if (trace_count == TRACE_BUFFER_RECORDS) trace_flush();
+}
+
+TraceRecord trace_node_begin(int ply, int depth, int alpha, int beta) {
+    TraceRecord rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.kind = TRACE_KIND_NODE;
+    rec.ply = (uint8_t)ply;
+    rec.depth = (int8_t)(depth < -128 ? -128 : depth);
+    rec.root_depth = trace_root_depth;
+    rec.cut_index = 255;
+    rec.alpha = alpha;
+    rec.beta = beta;
+    return rec;
+}
+
+void trace_iteration(int depth, int alpha, int beta, int score, TraceAspiration aspiration) {
+    TraceRecord rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.kind = TRACE_KIND_ITERATION;
+    rec.depth = (int8_t)depth;
+    rec.root_depth = (uint8_t)depth;
+    rec.cutoff = (uint8_t)aspiration;
+    rec.cut_index = 255;
+    rec.alpha = alpha;
+    rec.beta = beta;
+    rec.score = score;
+    trace_write(&rec);
+}
+
+void trace_set_depth(int depth) {
+    trace_root_depth = (uint8_t)depth;
+}
+
+#endif // TRACE
@@ -0,0 +1,104 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// TRACE BINAIRE DE LA RECHERCHE
+// Activée seulement à la compilation avec -DTRACE (make TRACE=1), puis à l'exécution
+// par trace_open(). Un enregistrement de 32 octets par noeud de negamax (écrit à la sortie
+// du noeud) et un par itération de l'iterative deepening, écrit après les noeuds de
+// l'itération (une itération ratée par l'aspiration est suivie de sa re-recherche).
+// Analyse : trace_summary.exe.
+
+#define TRACE_MAGIC "AWALETR"
+#define TRACE_VERSION 1
+
+typedef enum {
+    TRACE_KIND_NODE,
+    TRACE_KIND_ITERATION
+} TraceKind;
+
+// Comment le noeud s'est terminé
+typedef enum {
+    TRACE_CUT_NONE,       // Tous les coups cherchés (noeud PV ou ALL)
+    TRACE_CUT_BETA,       // Coupure beta sur le coup cut_index
+    TRACE_CUT_TT,         // Réponse de la table de transposition
+    TRACE_CUT_NULL,       // Coupure par le coup nul
+    TRACE_CUT_TERMINAL,   // Fin de partie
+    TRACE_CUT_LEAF,       // Évaluation (profondeur 0 ou aucun coup)
+    TRACE_CUT_PRUNED      // Razoring ou ProbCut
+} TraceCutoff;
+
+typedef enum {
+    TRACE_TT_MISS,
+    TRACE_TT_MOVE,        // Entrée trouvée : coup utilisé pour le tri, pas de coupure
+    TRACE_TT_CUTOFF
+} TraceTT;
+
+// Résultat d'une itération par rapport à la fenêtre d'aspiration
+typedef enum {
+    TRACE_ASP_INSIDE,
+    TRACE_ASP_FAIL_LOW,
+    TRACE_ASP_FAIL_HIGH
+} TraceAspiration;
+
+typedef struct {
+    uint8_t kind;             // TraceKind
+    uint8_t ply;
+    int8_t depth;             // Profondeur restante (itération : profondeur cherchée)
+    uint8_t root_depth;       // Itération en cours
+    uint8_t cutoff;           // TraceCutoff (itération : TraceAspiration)
+    uint8_t tt;               // TraceTT
+    uint8_t cut_index;        // Index du coup qui a coupé (255 si pas de coupure)
+    uint8_t n_moves;          // Coups générés
+    uint8_t reduction;        // Plus forte réduction LMR appliquée dans ce noeud
+    uint8_t lmr_searches;     // Coups cherchés réduits
+    uint8_t lmr_researches;   // Réduits puis recherchés à pleine profondeur
+    uint8_t zw_searches;      // Recherches à fenêtre nulle (PVS)
+    uint8_t pvs_researches;   // Fenêtre nulle ratée : recherche à fenêtre complète
+    uint8_t null_move;        // 0 : pas essayé, 1 : essayé sans coupure, 2 : coupure
+    uint8_t reserved[2];
+    int32_t alpha;            // Fenêtre à l'entrée du noeud
+    int32_t beta;
+    int32_t score;
+    uint32_t reserved2;
+} TraceRecord;
+
+#ifdef TRACE
+
+bool trace_open(const char* path);
+void trace_close(void);
+void trace_write(const TraceRecord* rec);
+TraceRecord trace_node_begin(int ply, int depth, int alpha, int beta);
+void trace_iteration(int depth, int alpha, int beta, int score, TraceAspiration aspiration);
+void trace_set_depth(int depth);
+
+// Un TraceRecord local par noeud, rempli au fil de la recherche puis écrit à la sortie
+#define TRACE_NODE(ply, depth, alpha, beta) \
+    TraceRecord trace_rec_ = trace_node_begin(ply, depth, alpha, beta)
+#define TRACE_SET(field, value) (trace_rec_.field = (value))
+#define TRACE_INC(field)        (trace_rec_.field++)
+#define TRACE_MAX(field, value) \
+    (trace_rec_.field = ((value) > trace_rec_.field) ? (value) : trace_rec_.field)
+#define TRACE_END(cut, value) do { \
+        trace_rec_.cutoff = (cut); \
+        trace_rec_.score = (value); \
+        trace_write(&trace_rec_); \
+    } while (0)
+#define TRACE_ITERATION(depth, alpha, beta, score, asp) trace_iteration(depth, alpha, beta, score, asp)
+#define TRACE_DEPTH(depth)      trace_set_depth(depth)
+
+#else
+
+#define TRACE_NODE(ply, depth, alpha, beta)             ((void)0)
+#define TRACE_SET(field, value)                         ((void)0)
+#define TRACE_INC(field)                                ((void)0)
+#define TRACE_MAX(field, value)                         ((void)0)
+#define TRACE_END(cut, value)                           ((void)0)
+#define TRACE_ITERATION(depth, alpha, beta, score, asp) ((void)0)
+#define TRACE_DEPTH(depth)                              ((void)0)
+
+#endif // TRACE
+
+#endif // TRACE_H
@@ -0,0 +1,129 @@
+// Analyse d'une trace de recherche (make TRACE=1, bot --trace fichier)
+// Par profondeur restante : taux de coupure au premier coup, coupures TT et coup nul,
+// taux de re-recherche LMR et PVS. Par itération : noeuds, échecs d'aspiration et
+// facteur de branchement effectif (noeuds de l'itération d / noeuds de l'itération d-1).
+// Usage : trace_summary.exe <fichier>
+#include "trace.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_TRACE_DEPTH 32
+#define READ_RECORDS 4096
+
+typedef struct {
+    uint64_t nodes, interior, beta_cuts, first_cuts, tt_cuts;
+    uint64_t null_tries, null_cuts;
+    uint64_t lmr, lmr_re, zw, pvs_re;
+} DepthStats;
+
+typedef struct {
+    uint64_t searches, nodes, fail_low, fail_high;
+    uint64_t ebf_nodes, ebf_base; // Paires (d-1, d) terminées dans la même recherche
+} IterationStats;
+
+static DepthStats by_depth[MAX_TRACE_DEPTH];
+static IterationStats by_iter[MAX_TRACE_DEPTH];
+
+static double pct(uint64_t a, uint64_t b) {
+    return b ? 100.0 * (double)a / (double)b : 0.0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <trace>\n", argv[0]);
+        return 1;
+    }
+    FILE* f = fopen(argv[1], "rb");
+    if (!f) {
+        fprintf(stderr, "Impossible d'ouvrir %s\n", argv[1]);
+        return 1;
+    }
+    char header[16];
+    uint32_t size = 0;
+    if (fread(header, sizeof(header), 1, f) != 1 || memcmp(header, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0) {
+        fprintf(stderr, "Pas une trace: %s\n", argv[1]);
+        fclose(f);
+        return 1;
+    }
+    memcpy(&size, header + 12, 4);
+    if (size != sizeof(TraceRecord)) {
+        fprintf(stderr, "Taille d'enregistrement inattendue (%u)\n", size);
+        fclose(f);
+        return 1;
+    }
+
+    static TraceRecord recs[READ_RECORDS];
+    uint64_t total = 0, pending = 0;
+    int last_depth = 0;          // Dernière itération terminée de la recherche en cours
+    uint64_t last_nodes = 0;
+    size_t n;
+
+    while ((n = fread(recs, sizeof(TraceRecord), READ_RECORDS, f)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            const TraceRecord* r = &recs[i];
+            if (r->kind == TRACE_KIND_NODE) {
+                int d = r->depth < 0 ? 0 : (r->depth >= MAX_TRACE_DEPTH ? MAX_TRACE_DEPTH - 1 : r->depth);
+                DepthStats* s = &by_depth[d];
+                s->nodes++;
+                if (r->cutoff == TRACE_CUT_NONE || r->cutoff == TRACE_CUT_BETA) s->interior++;
+                if (r->cutoff == TRACE_CUT_BETA) {
+                    s->beta_cuts++;
+                    if (r->cut_index == 0) s->first_cuts++;
+                }
+                if (r->cutoff == TRACE_CUT_TT) s->tt_cuts++;
+                if (r->null_move) s->null_tries++;
+                if (r->null_move == 2) s->null_cuts++;
+                s->lmr += r->lmr_searches;
+                s->lmr_re += r->lmr_researches;
+                s->zw += r->zw_searches;
+                s->pvs_re += r->pvs_researches;
+                pending++;
+                total++;
+                continue;
+            }
+
+            // Fin d'itération (ou échec d'aspiration : la re-recherche suit)
+            int d = r->depth >= MAX_TRACE_DEPTH ? MAX_TRACE_DEPTH - 1 : r->depth;
+            IterationStats* it = &by_iter[d];
+            if (r->cutoff == TRACE_ASP_FAIL_LOW) it->fail_low++;
+            if (r->cutoff == TRACE_ASP_FAIL_HIGH) it->fail_high++;
+            if (r->cutoff != TRACE_ASP_INSIDE) continue;
+
+            if (d <= last_depth) last_depth = 0; // Nouvelle recherche (nouveau coup)
+            it->searches++;
+            it->nodes += pending;
+            if (d == last_depth + 1 && last_depth > 0) {
+                it->ebf_nodes += pending;
+                it->ebf_base += last_nodes;
+            }
+            last_depth = d;
+            last_nodes = pending;
+            pending = 0;
+        }
+    }
+    fclose(f);
+
+    printf("%llu noeuds\n\n", (unsigned long long)total);
+    printf("prof  %10s %8s %8s %8s %8s %8s %8s\n", "noeuds", "coupure", "1er coup", "TT", "nul", "LMR re",
+           "PVS re");
+    for (int d = MAX_TRACE_DEPTH - 1; d >= 0; d--) {
+        const DepthStats* s = &by_depth[d];
+        if (!s->nodes) continue;
+        printf("%4d  %10llu %7.1f%% %7.1f%% %7.1f%% %7.1f%% %7.1f%% %7.1f%%\n", d,
+               (unsigned long long)s->nodes, pct(s->beta_cuts, s->interior), pct(s->first_cuts, s->beta_cuts),
+               pct(s->tt_cuts, s->nodes), pct(s->null_cuts, s->null_tries), pct(s->lmr_re, s->lmr),
+               pct(s->pvs_re, s->zw));
+    }
+
+    printf("\niter  %10s %10s %8s %8s %6s\n", "recherches", "noeuds", "asp bas", "asp haut", "EBF");
+    for (int d = 1; d < MAX_TRACE_DEPTH; d++) {
+        const IterationStats* it = &by_iter[d];
+        if (!it->searches && !it->fail_low && !it->fail_high) continue;
+        printf("%4d  %10llu %10llu %8llu %8llu ", d, (unsigned long long)it->searches,
+               (unsigned long long)it->nodes, (unsigned long long)it->fail_low,
+               (unsigned long long)it->fail_high);
+        if (it->ebf_base) printf("%6.2f\n", (double)it->ebf_nodes / (double)it->ebf_base);
+        else printf("%6s\n", "-");
+    }
+    return 0;
+}
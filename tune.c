@@ -0,0 +1,347 @@
+// Réglage des poids de l'évaluation sur des positions de self-play (méthode "Texel")
+// Les poids sont ajustés pour que sigmoid(k * evaluate) prédise le résultat final de la partie
+// (1 gagnée, 0.5 nulle, 0 perdue pour le joueur au trait), en minimisant l'erreur quadratique.
+// Hors fins de partie, la note est linéaire en les poids (eval_params.h) : les termes de chaque
+// position sont calculés une fois par l'évaluation par lots, puis chaque époque ne fait plus que
+// des produits scalaires, répartis sur plusieurs threads.
+// Usage : tune.exe <fichier selfplay> [out params.txt] [threads N] [epochs N] [rate X]
+//                  [init params.txt] [limit N] [valid %]
+#define _POSIX_C_SOURCE 200112L
+#include "ai.h"
+#include "ai_advanced.h"
+#include "eval_params.h"
+#include "selfplay_record.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#define MAX_THREADS 64
+#define DEFAULT_EPOCHS 300
+#define DEFAULT_RATE 1.0
+#define DEFAULT_VALID_PERCENT 10
+#define REPORT_EVERY 25
+
+// Un lot de positions déjà décomposées en termes (fins de partie exclues)
+typedef struct {
+    int count;
+    int16_t feature[EVAL_PARAMS][EVAL_BATCH_MAX];
+    float target[EVAL_BATCH_MAX];
+} TuneBlock;
+
+// Part de travail d'un thread : blocs [first, last)
+typedef struct {
+    TuneBlock* blocks;
+    int first, last;
+    // Extraction des termes
+    const RecordReader* reader;
+    // Erreur et gradient
+    const float* weights;
+    float k;
+    bool want_grad;
+    double loss;
+    double grad[EVAL_PARAMS];
+    long positions;
+} TuneJob;
+
+typedef struct {
+    const char* out;
+    const char* init;
+    int threads;
+    int epochs;
+    double rate;
+    long limit;
+    int valid_percent;
+} TuneOptions;
+
+static uint64_t now_us(void) {
+#ifdef _WIN32
+    return (uint64_t)GetTickCount64() * 1000;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+#endif
+}
+
+static int default_threads(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+// Lance fn sur chaque job dans son thread, et attend la fin de tous
+static void run_parallel(TuneJob* jobs, int n_jobs, void* (*fn)(void*)) {
+    pthread_t threads[MAX_THREADS];
+    bool started[MAX_THREADS];
+    for (int t = 0; t < n_jobs; t++) {
+        started[t] = pthread_create(&threads[t], NULL, fn, &jobs[t]) == 0;
+        if (!started[t]) fn(&jobs[t]); // Pas de thread dispo : on le fait ici
+    }
+    for (int t = 0; t < n_jobs; t++) {
+        if (started[t]) pthread_join(threads[t], NULL);
+    }
+}
+
+// Répartit les blocs [first, last) entre n_jobs jobs
+static void split_jobs(TuneJob* jobs, int n_jobs, TuneBlock* blocks, int first, int last) {
+    for (int t = 0; t < n_jobs; t++) {
+        memset(&jobs[t], 0, sizeof(TuneJob));
+        jobs[t].blocks = blocks;
+        jobs[t].first = first + (int)((long)(last - first) * t / n_jobs);
+        jobs[t].last = first + (int)((long)(last - first) * (t + 1) / n_jobs);
+    }
+}
+
+
+// EXTRACTION DES TERMES
+
+
+// Bloc b = enregistrements [b * EVAL_BATCH_MAX, ...) de l'ordre (mélangé) du lecteur
+static void* extract_worker(void* arg) {
+    TuneJob* job = arg;
+    EvalBatch* batch = malloc(sizeof(EvalBatch));
+    EvalFeatures* features = malloc(sizeof(EvalFeatures));
+    if (!batch || !features) {
+        free(batch);
+        free(features);
+        return NULL;
+    }
+    size_t total = job->reader->count;
+    for (int b = job->first; b < job->last; b++) {
+        size_t start = (size_t)b * EVAL_BATCH_MAX;
+        int n = (int)((total - start < EVAL_BATCH_MAX) ? total - start : EVAL_BATCH_MAX);
+        float result[EVAL_BATCH_MAX];
+        for (int i = 0; i < n; i++) {
+            const SelfPlayRecord* rec = record_reader_get(job->reader, start + (size_t)i);
+            GameState game;
+            record_unpack(rec, &game);
+            ai_batch_set(batch, i, &game.board, game.current, game.score);
+            result[i] = (float)(rec->result + 1) * 0.5f;
+        }
+        batch->count = n;
+        ai_evaluate_features(batch, features);
+
+        // Les fins de partie ont une note fixe : elles ne disent rien sur les poids
+        TuneBlock* block = &job->blocks[b];
+        int kept = 0;
+        for (int i = 0; i < n; i++) {
+            if (features->terminal[i]) continue;
+            for (int p = 0; p < EVAL_PARAMS; p++) block->feature[p][kept] = (int16_t)features->feature[p][i];
+            block->target[kept++] = result[i];
+        }
+        block->count = kept;
+        job->positions += kept;
+    }
+    free(batch);
+    free(features);
+    return NULL;
+}
+
+
+// ERREUR ET GRADIENT
+
+
+// Somme des erreurs (et de leur gradient) sur les blocs du job, une boucle par poids
+static void* loss_worker(void* arg) {
+    TuneJob* job = arg;
+    float eval[EVAL_BATCH_MAX], slope[EVAL_BATCH_MAX];
+    for (int b = job->first; b < job->last; b++) {
+        const TuneBlock* block = &job->blocks[b];
+        int n = block->count;
+        for (int i = 0; i < n; i++) eval[i] = 0.0f;
+        for (int p = 0; p < EVAL_PARAMS; p++) {
+            float w = job->weights[p];
+            for (int i = 0; i < n; i++) eval[i] += w * (float)block->feature[p][i];
+        }
+        double loss = 0.0;
+        for (int i = 0; i < n; i++) {
+            float s = 1.0f / (1.0f + expf(-job->k * eval[i]));
+            float d = s - block->target[i];
+            loss += (double)(d * d);
+            slope[i] = d * s * (1.0f - s);
+        }
+        job->loss += loss;
+        job->positions += n;
+        if (!job->want_grad) continue;
+        for (int p = 0; p < EVAL_PARAMS; p++) {
+            float g = 0.0f;
+            for (int i = 0; i < n; i++) g += slope[i] * (float)block->feature[p][i];
+            job->grad[p] += (double)g;
+        }
+    }
+    return NULL;
+}
+
+// Erreur moyenne sur les blocs [first, last) ; gradient de cette moyenne si grad != NULL
+static double mean_loss(TuneBlock* blocks, int first, int last, int n_threads, const float* weights, float k,
+                        double* grad) {
+    TuneJob jobs[MAX_THREADS];
+    split_jobs(jobs, n_threads, blocks, first, last);
+    for (int t = 0; t < n_threads; t++) {
+        jobs[t].weights = weights;
+        jobs[t].k = k;
+        jobs[t].want_grad = (grad != NULL);
+    }
+    run_parallel(jobs, n_threads, loss_worker);
+
+    double loss = 0.0;
+    long positions = 0;
+    if (grad) memset(grad, 0, sizeof(double) * EVAL_PARAMS);
+    for (int t = 0; t < n_threads; t++) {
+        loss += jobs[t].loss;
+        positions += jobs[t].positions;
+        for (int p = 0; grad && p < EVAL_PARAMS; p++) grad[p] += jobs[t].grad[p];
+    }
+    if (positions == 0) return 0.0;
+    for (int p = 0; grad && p < EVAL_PARAMS; p++) grad[p] *= 2.0 * k / (double)positions;
+    return loss / (double)positions;
+}
+
+// Échelle k de la sigmoïde : minimise l'erreur des poids de départ (section dorée sur log10 k)
+static float fit_scale(TuneBlock* blocks, int n_blocks, int n_threads, const float* weights) {
+    double lo = -5.0, hi = -1.0;
+    const double phi = 0.6180339887498949;
+    double a = hi - phi * (hi - lo), b = lo + phi * (hi - lo);
+    double fa = mean_loss(blocks, 0, n_blocks, n_threads, weights, (float)pow(10.0, a), NULL);
+    double fb = mean_loss(blocks, 0, n_blocks, n_threads, weights, (float)pow(10.0, b), NULL);
+    for (int i = 0; i < 40; i++) {
+        if (fa < fb) {
+            hi = b, b = a, fb = fa;
+            a = hi - phi * (hi - lo);
+            fa = mean_loss(blocks, 0, n_blocks, n_threads, weights, (float)pow(10.0, a), NULL);
+        } else {
+            lo = a, a = b, fa = fb;
+            b = lo + phi * (hi - lo);
+            fb = mean_loss(blocks, 0, n_blocks, n_threads, weights, (float)pow(10.0, b), NULL);
+        }
+    }
+    return (float)pow(10.0, (lo + hi) / 2);
+}
+
+
+// RÉGLAGE
+
+
+static int tune(const char* path, const TuneOptions* opt) {
+    RecordReader reader;
+    if (!record_reader_open(&reader, path)) {
+        fprintf(stderr, "Fichier invalide: %s\n", path);
+        return 1;
+    }
+    if (opt->init && !eval_params_load(opt->init)) {
+        fprintf(stderr, "Poids illisibles: %s\n", opt->init);
+        record_reader_close(&reader);
+        return 1;
+    }
+    // Ordre mélangé (graine fixe) : les positions de validation viennent de toutes les parties
+    record_reader_shuffle(&reader, 1);
+    if (opt->limit > 0 && (size_t)opt->limit < reader.count) reader.count = (size_t)opt->limit;
+
+    int n_blocks = (int)((reader.count + EVAL_BATCH_MAX - 1) / EVAL_BATCH_MAX);
+    TuneBlock* blocks = malloc(sizeof(TuneBlock) * (size_t)(n_blocks > 0 ? n_blocks : 1));
+    if (!blocks) {
+        fprintf(stderr, "Mémoire insuffisante (%d blocs)\n", n_blocks);
+        record_reader_close(&reader);
+        return 1;
+    }
+
+    uint64_t start = now_us();
+    TuneJob jobs[MAX_THREADS];
+    split_jobs(jobs, opt->threads, blocks, 0, n_blocks);
+    long positions = 0;
+    for (int t = 0; t < opt->threads; t++) jobs[t].reader = &reader;
+    run_parallel(jobs, opt->threads, extract_worker);
+    for (int t = 0; t < opt->threads; t++) positions += jobs[t].positions;
+    printf("%ld positions (%zu lues, fins de partie exclues), %d threads, termes en %.1f s\n", positions,
+           reader.count, opt->threads, (now_us() - start) / 1e6);
+    record_reader_close(&reader);
+
+    int n_valid = n_blocks * opt->valid_percent / 100;
+    int n_train = n_blocks - n_valid;
+    if (positions == 0 || n_train == 0) {
+        fprintf(stderr, "Pas assez de positions\n");
+        free(blocks);
+        return 1;
+    }
+
+    float weights[EVAL_PARAMS];
+    for (int p = 0; p < EVAL_PARAMS; p++) weights[p] = (float)eval_params[p];
+    float k = fit_scale(blocks, n_train, opt->threads, weights);
+    double train = mean_loss(blocks, 0, n_train, opt->threads, weights, k, NULL);
+    double valid = mean_loss(blocks, n_train, n_blocks, opt->threads, weights, k, NULL);
+    printf("k = %.6f ; départ : erreur %.6f (apprentissage), %.6f (validation)\n", k, train, valid);
+
+    // Descente de gradient Adam (pas en unités de poids)
+    double m[EVAL_PARAMS] = {0}, v[EVAL_PARAMS] = {0}, grad[EVAL_PARAMS];
+    const double beta1 = 0.9, beta2 = 0.999, eps = 1e-12;
+    start = now_us();
+    for (int epoch = 1; epoch <= opt->epochs; epoch++) {
+        train = mean_loss(blocks, 0, n_train, opt->threads, weights, k, grad);
+        for (int p = 0; p < EVAL_PARAMS; p++) {
+            m[p] = beta1 * m[p] + (1 - beta1) * grad[p];
+            v[p] = beta2 * v[p] + (1 - beta2) * grad[p] * grad[p];
+            double m_hat = m[p] / (1 - pow(beta1, epoch));
+            double v_hat = v[p] / (1 - pow(beta2, epoch));
+            weights[p] -= (float)(opt->rate * m_hat / (sqrt(v_hat) + eps));
+        }
+        if (epoch % REPORT_EVERY == 0 || epoch == opt->epochs) {
+            valid = n_valid ? mean_loss(blocks, n_train, n_blocks, opt->threads, weights, k, NULL) : 0.0;
+            printf("époque %4d : erreur %.6f (apprentissage), %.6f (validation), %.1f s\n", epoch, train, valid,
+                   (now_us() - start) / 1e6);
+            fflush(stdout);
+        }
+    }
+
+    int tuned[EVAL_PARAMS];
+    printf("\n%-18s %8s %8s\n", "poids", "avant", "après");
+    for (int p = 0; p < EVAL_PARAMS; p++) {
+        tuned[p] = (int)lrintf(weights[p]);
+        printf("%-18s %8d %8d\n", eval_param_names[p], eval_params[p], tuned[p]);
+    }
+    free(blocks);
+
+    if (opt->out) {
+        if (!eval_params_save(opt->out, tuned)) {
+            fprintf(stderr, "Écriture impossible: %s\n", opt->out);
+            return 1;
+        }
+        printf("-> %s (bot_lounis_ouahrani.exe --eval-params %s)\n", opt->out, opt->out);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <fichier selfplay> [out params.txt] [threads N] [epochs N] [rate X] "
+                        "[init params.txt] [limit N] [valid %%]\n", argv[0]);
+        return 1;
+    }
+    TuneOptions opt = {NULL, NULL, default_threads(), DEFAULT_EPOCHS, DEFAULT_RATE, 0, DEFAULT_VALID_PERCENT};
+    for (int i = 2; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "out") == 0) opt.out = argv[i + 1];
+        else if (strcmp(argv[i], "init") == 0) opt.init = argv[i + 1];
+        else if (strcmp(argv[i], "threads") == 0) opt.threads = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "epochs") == 0) opt.epochs = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "rate") == 0) opt.rate = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "limit") == 0) opt.limit = atol(argv[i + 1]);
+        else if (strcmp(argv[i], "valid") == 0) opt.valid_percent = atoi(argv[i + 1]);
+    }
+    if (opt.threads < 1) opt.threads = 1;
+    if (opt.threads > MAX_THREADS) opt.threads = MAX_THREADS;
+    if (opt.valid_percent < 0 || opt.valid_percent > 50) opt.valid_percent = DEFAULT_VALID_PERCENT;
+    return tune(argv[1], &opt);
+}
@@ -0,0 +1,23 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <stdint.h>
+#include "board.h"
+
+// On prévoit un max de graines pour le hachage pour éviter les débordements
+#define MAX_SEEDS_PER_HOLE 50
+#define ZOBRIST_MAX_SCORE 100
+#define ZOBRIST_MAX_HALF_MOVES 101
+
+// Graine fixe : les clés sont les mêmes d'un lancement à l'autre
+// (nécessaire pour garder une table sur disque ou partagée entre processus)
+#define ZOBRIST_SEED 0x123456789ABCDEF0ULL
+
+// Tableaux de nombres aléatoires pour le Zobrist Hashing, générés à la compilation
+// par gen_zobrist.c (cf. Makefile) dans zobrist_table.c
+extern const uint64_t zobrist_keys[N_HOLES][3][MAX_SEEDS_PER_HOLE];
+extern const uint64_t zobrist_player[2];
+extern const uint64_t zobrist_scores[3][ZOBRIST_MAX_SCORE];
+extern const uint64_t zobrist_half_moves[ZOBRIST_MAX_HALF_MOVES];
+
+#endif // ZOBRIST_H
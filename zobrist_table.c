@@ -0,0 +1,874 @@
+// Fichier généré par gen_zobrist.c, ne pas modifier à la main
+#include "zobrist.h"
+
+const uint64_t zobrist_keys[N_HOLES][3][MAX_SEEDS_PER_HOLE] = {
+    {
+        {
+            0xFE800D6569FA1B4DULL, 0x0CE7C497A6B09C3BULL, 0x41DFB69A11DB93C3ULL, 0x6CF2AF81492CB424ULL,
+            0x3E23AF875E8F644CULL, 0x8EF8DC1BCC6AE984ULL, 0x31EA2A2C06D6DD57ULL, 0x9F00942EBA9CC52DULL,
+            0x1F69F901F7B317E7ULL, 0x88F9A0B2AA756808ULL, 0xE9B9D4E2FECA80D8ULL, 0x52D873359E3E23D9ULL,
+            0x26E0C090AD4D89DEULL, 0x5FA9EC0E24D4A54DULL, 0x93674AFE6793FF47ULL, 0x94CCF797D2B9E979ULL,
+            0xE99CAD48A79FE4EBULL, 0xD95D89A12E7081E2ULL, 0x96D6BF5750F25861ULL, 0x1A793E7080EB8491ULL,
+            0xBDAE1703842957D8ULL, 0x8923BC564561F377ULL, 0xB37339E1955B0D51ULL, 0xFF5F576DFF0ECF0BULL,
+            0x0F23F019DE087055ULL, 0x655C490ACA48D5F5ULL, 0x396344CC656B991EULL, 0x2ABA9538473CC9ACULL,
+            0x3525658ED7CB5B3FULL, 0xB4B531A29747E249ULL, 0xD1BD9E3D4042DFCDULL, 0xE60C214163E80932ULL,
+            0xE8AC7131B14BD5A0ULL, 0xC16AA746AE7E2A0BULL, 0x787185BE10D7349FULL, 0xDE00B47B05C45D36ULL,
+            0x5FCAD996B966580CULL, 0xF9BFF3A129FB17BCULL, 0x85A2AE066ABC8E93ULL, 0x9EEC16A73E04334EULL,
+            0x1D0A6EBF264D28A8ULL, 0x32B8EDDF5FAC98F9ULL, 0x2F103273263ADF88ULL, 0xFD3EC079855E4837ULL,
+            0x031C42B3DA0E1967ULL, 0xD15F57A0843ABC95ULL, 0x188F29B705574CACULL, 0x895D14B945714935ULL,
+            0x7B432D71CF4146E7ULL, 0x83B16615EF069DAAULL,
+        },
+        {
+            0xD6A891D7A2E8BA11ULL, 0x479800C23E8BCF25ULL, 0xC835845E0217B1FBULL, 0x0966A315CD708058ULL,
+            0xF9A3470C44717758ULL, 0x045A9683E92343B6ULL, 0xAAC662DE9F3528B1ULL, 0x72E41EF4D7174EA0ULL,
+            0x12E4D46382C4C83DULL, 0x639EAE9AB02EEEEDULL, 0x71FDC53F03C8A870ULL, 0xEAD1A4DAD0AB2520ULL,
+            0x09923DFC5DB33B6AULL, 0x94FCB0712193C79CULL, 0xE020CECED1F48713ULL, 0x35B9A5F0342ECADDULL,
+            0x5963A16C06BF8008ULL, 0x56E5BF5F7B43FD08ULL, 0x79E299411B0F38F2ULL, 0x7436548609EF5A03ULL,
+            0x0EFAF2445D846477ULL, 0x6A1D6C561A56917FULL, 0xC69D6391F6D3839DULL, 0x6DD8A0ABD61963DAULL,
+            0xFA8616F1E4ACE79DULL, 0x0C49FB6F428BF912ULL, 0x8572D8BD9512EA60ULL, 0x9E4E4F5758A657B4ULL,
+            0x8D1DC7E3F942761BULL, 0xC2FE3A6608801437ULL, 0x38B852A515ACF9DFULL, 0x61687EF4C45A37ECULL,
+            0x790D70F68CA4F883ULL, 0xDAFC290734F7F1B2ULL, 0xB36E84AE9CF632D1ULL, 0x2000D5ACAFF14AF4ULL,
+            0x6F646D9709609561ULL, 0xA057FA5435ED2C0BULL, 0xD383C0896A6A9493ULL, 0x3AFAA90DBA7D057AULL,
+            0x3FF995B15D07E1F0ULL, 0x4F8E259AA61D9233ULL, 0x9D5C475D2DDD45D7ULL, 0x0FDA1DF99D556A9CULL,
+            0x84E2C8C258F4E749ULL, 0x31F78DF0841BFCC7ULL, 0xDD5B36A129881AFEULL, 0xA19618B3E014754BULL,
+            0xAAB57CB8D2A26F61ULL, 0x416AAEC0E18ED3FFULL,
+        },
+        {
+            0xBBB264997AB6D198ULL, 0xE47F76D18BB2DA3BULL, 0x10E133803DCA514FULL, 0x1A5E1C49E956762DULL,
+            0xC6274C9802DEF181ULL, 0x675F92F443130C22ULL, 0xA56D0507CBA662BAULL, 0xCAD1A4766000C0FFULL,
+            0x52EEFF78A9931EBEULL, 0x5F27563EF1D65703ULL, 0x26A32F94859A5B6DULL, 0x7B641E8DA85C149BULL,
+            0x78E68DE4F27EEA72ULL, 0xE7105551EF22CB26ULL, 0xD4A8A631D34A8730ULL, 0x432E24378ED7DE3EULL,
+            0x8E2ADBB2D3FE3E02ULL, 0xA56B24E28BEA02FEULL, 0xF69D7331A6D4A97BULL, 0x3A837A5C984E3EE9ULL,
+            0xA46C92DF848438D4ULL, 0x2F4C37B896D385A5ULL, 0x0EB8147FF477EBEEULL, 0x06665314946A3FB9ULL,
+            0x5DA9086EAB362586ULL, 0x55396A01AFC3E84DULL, 0x2205EF9998D5DCDDULL, 0xFCBD7B2BE540E024ULL,
+            0x3C664AE12F7EE8E4ULL, 0xC371C4DDB7ECAC35ULL, 0xB7956299D274D82DULL, 0xB33C1BA1D2599ADDULL,
+            0x537AD82949903EA8ULL, 0x159DFF4A1173B4D5ULL, 0x031D0A5322DEC6FCULL, 0x22BA173E63174471ULL,
+            0xA14905F69FFC56B9ULL, 0xF3BE37A747A92054ULL, 0xA0F9C425094CE714ULL, 0xA6C086CCFB313BDAULL,
+            0xE046387C57A8EF2DULL, 0x64DF905FF3BFD5B3ULL, 0x1A1174C314ABA6D8ULL, 0x3C159D1A439A4795ULL,
+            0xFF2E0A3FB5CA365AULL, 0x60EAD2B1178B74B6ULL, 0x29887A7FE6518FDFULL, 0x35FB71B2CA053B00ULL,
+            0x3E3DA1DC6B53F176ULL, 0xCACCD240EF7FCB14ULL,
+        },
+    },
+    {
+        {
+            0xDC455652AB357182ULL, 0x4C06C72C1ACD3BE1ULL, 0x90302F69A56679D6ULL, 0xD71360E2E1C200A5ULL,
+            0xFF3F0B890F5D0DE4ULL, 0x721E614EF6424EFFULL, 0x1EB8B53C99A695A2ULL, 0x3887AF4DBB96F009ULL,
+            0x44EAF2B6E40EFFA9ULL, 0xB65FFD7305A02816ULL, 0xB49B63BBD52FADC6ULL, 0x5B05F8809AEC431DULL,
+            0x65C8915F511CFCDBULL, 0x0C18D3BF10DE93E2ULL, 0xC9CCF988A7AD9645ULL, 0x7B1FC838171DFC29ULL,
+            0x7580C4DDC4EBED91ULL, 0xF8B13AEEC43F7E0AULL, 0xA908C8FE7D45C276ULL, 0xE3C7F85A40651472ULL,
+            0x4E99B76B4A9A82DAULL, 0x178CE26CE84A415FULL, 0x71E02BD9AF1B621DULL, 0x247F45BA51EC7399ULL,
+            0xF2603FD80A5C6D3EULL, 0xE5AD4906143C5A64ULL, 0x6D39A80AEBEE3BD0ULL, 0x51B30107E58313A7ULL,
+            0x85690BBCD0781C40ULL, 0xFC77C43F4CA7FC78ULL, 0x9F18056DBF4EAD80ULL, 0x2D481DB7C39D50DBULL,
+            0x1EBCDAA598213CBAULL, 0xF60640E0DC4F1043ULL, 0xE1D9B7A8117DFEA3ULL, 0x0F5BAF053AC8CD9EULL,
+            0x86D748376C37FB85ULL, 0x62FBE6395A05D532ULL, 0x77C69226B752D218ULL, 0x2443A9D297B3F1BCULL,
+            0x407E487C52E9795FULL, 0xCB295FD707E31C6DULL, 0xD1B87D19F08C6115ULL, 0x34BBAD2155799C97ULL,
+            0x309F4CCC2EFAAA6EULL, 0x51B67E01543404BAULL, 0xEF170E3ADF6C0233ULL, 0xE43416549C7A36F7ULL,
+            0x9793A2F353A59F5AULL, 0x44278C0A6A4642E4ULL,
+        },
+        {
+            0xAD4DC27DC99CF761ULL, 0xEA59E804A64036CFULL, 0x4A9DBD84F31CE562ULL, 0x0F963B7F293FC428ULL,
+            0x92A0EDD70359B1A0ULL, 0xFD4AA3A998816AC3ULL, 0x775C62FDB71EB8D6ULL, 0x5D996A3EBC8A7027ULL,
+            0x71965A03B7658D07ULL, 0xBACE31271772E7DDULL, 0x70CEB45273BA5552ULL, 0x40AA951519923578ULL,
+            0x5EBA054D8FA74F12ULL, 0x398FBAC31E91850CULL, 0x220C6E7BC6606506ULL, 0x8FA9DA30EDCD244CULL,
+            0x858AAFAA01DE2D04ULL, 0xF142DFA2474A505EULL, 0x5F28CCD3BDA7137EULL, 0xFA1CFCFF14C742D8ULL,
+            0x55FE7E91C7DF7A5DULL, 0xA6D5E76D1B17F3E9ULL, 0x7303C1C7F63C064EULL, 0x99D1A54E2D9C2DC2ULL,
+            0x8C5A36D419462519ULL, 0xA23BFC2ABA78CF13ULL, 0x706307885C479A4DULL, 0x408274B8E2222639ULL,
+            0x8A53FD7CC7C2CC35ULL, 0xCE88B3BE5EA2E4EDULL, 0xD47B2AECA2F33A64ULL, 0x57DBB3A62A14C510ULL,
+            0x71FEDFAE2AE7A89AULL, 0xB2D1785138DD014BULL, 0x4F08F27F1ED78989ULL, 0x6EE8D7F46D8D64DAULL,
+            0x991CE3D95BB20893ULL, 0x0B118E1414112842ULL, 0x6FB89079A85F5A92ULL, 0xE93D852EA6C500A7ULL,
+            0x9B80B4ED6C104366ULL, 0xCABC56354E747A60ULL, 0x54F2677023920A94ULL, 0xAFA497CE71070B81ULL,
+            0xFB9D79F2C6FBC5D6ULL, 0x9AD5AD14EA8787DDULL, 0x9360FAB52D6CDF92ULL, 0xEA633C41C2A9A2ADULL,
+            0x28C96C3F2A41FAA8ULL, 0x2D8FE2185D84D35DULL,
+        },
+        {
+            0x30985CBACD16ADBBULL, 0x0D5D4A3334D08E20ULL, 0x90B3F44D3926A73CULL, 0xA0785BFA74FEA572ULL,
+            0x9CCFCD6FE26044B8ULL, 0x8F2BAF04F940AA31ULL, 0xB7A7CDF1BB948725ULL, 0xDC69933BA3F0C76BULL,
+            0x1AC49A5C08219C25ULL, 0x824112CA6768765DULL, 0x7C6E207A049291F1ULL, 0xFD42AE2A5725E892ULL,
+            0x7FD804C0F865C7C3ULL, 0x48492BC2E1049C8CULL, 0x47F079EDDB1A36B5ULL, 0xFA4B58E59FC70F98ULL,
+            0x19E3CD5B8BC66787ULL, 0x3A3E2E2AD4A8EA88ULL, 0xFAA9EE8284D0195DULL, 0x5C3E208C2AAA4E2FULL,
+            0x6C3A59C0334F7173ULL, 0x916146A12879D351ULL, 0xAA149506E759D4B7ULL, 0x7A392D9753C8AADEULL,
+            0xFFF7E45D02084C0BULL, 0x7A52DBA84F383E53ULL, 0x1AB2312CA3BDBAEFULL, 0x480DCF82967D9A5AULL,
+            0x3CF1188ED0A0B7EEULL, 0x19E0E4BC69D3CD01ULL, 0x0BD7BFF309E50ADBULL, 0xE735E2AC1BF3160EULL,
+            0x19F51A90BA84B3A2ULL, 0x3C651A8988231245ULL, 0x19BFA0A43BFD6521ULL, 0x0F58317BCF21F7ABULL,
+            0x45783A60B33F3E84ULL, 0xCA0EF0D399B461F9ULL, 0x41F915A27154577AULL, 0xE1F415A728E46154ULL,
+            0x8133D6542AAB7C96ULL, 0xB9402EC0D86DCFEFULL, 0xB6ACF300E4330FB0ULL, 0xC42E67C4839085AFULL,
+            0xBC74A65FA0CB2F64ULL, 0x712ABDB988D9E03AULL, 0x49A754D5CB431D7AULL, 0x8EB6311DD83D85C0ULL,
+            0x0A1819A741C28ECBULL, 0x59C6F40B9C17D916ULL,
+        },
+    },
+    {
+        {
+            0x9745E37093B37324ULL, 0x66B446BC49A85CC2ULL, 0xFF93A97EA9427CFBULL, 0x82F5928F0694A6C2ULL,
+            0x45B76869D7767F0FULL, 0xE5AF0B6F76C4B031ULL, 0xC4327E7AA5211511ULL, 0x2BFCA5935C7A337BULL,
+            0x193017C2D19B79DDULL, 0xA12B66D16D01986EULL, 0x9FA5D0873D0C40DEULL, 0x9F6FADB3A7C3AFDFULL,
+            0xBFFEE1C13B1C3F40ULL, 0xF55EB83457F1D73EULL, 0x274371378FEC3B10ULL, 0xDE6072F5D2532766ULL,
+            0xBBC3268BF88298A8ULL, 0x24FD44A9F3F2B799ULL, 0xD934BEB5232794B6ULL, 0xF3B73AC01E2C361FULL,
+            0xDA29C0CB80B809B3ULL, 0x408EA0A7D24D7560ULL, 0x49042E6ACF0CB78AULL, 0x07987BF857840C65ULL,
+            0x772330A3BDDEBD3DULL, 0x42399CCD84A3EF07ULL, 0xA941F96258838919ULL, 0x456CF2F11D65E84BULL,
+            0xB37A82A7B99A515BULL, 0xB0179DD37C245339ULL, 0x104C1AECB211F5DFULL, 0xCD580CD1525B41F4ULL,
+            0x88F5BEF51AFF0A77ULL, 0xA876171CBD0089A3ULL, 0x3D3B0164D58C8070ULL, 0x34686AF1E5E98570ULL,
+            0x4C84A33A58190A7AULL, 0x868038A0C678E6EEULL, 0x90C9020FDC566CA3ULL, 0x6105DFB50A9588BAULL,
+            0xEB7271F1EEA3CD2BULL, 0x0D7D6CEC9CCAA071ULL, 0xDCB7782131B70971ULL, 0x4283C6DBC97E1B23ULL,
+            0x273BCA977DA44FD5ULL, 0xB006900517A2520AULL, 0x1FEB40251704D42EULL, 0x0D0030342A961606ULL,
+            0x7B08F300D2D27BAAULL, 0x14B269B0C32675DDULL,
+        },
+        {
+            0xAB58323A796AEE76ULL, 0x2B9F5637C6B9662AULL, 0xFBA14AEC9764DE66ULL, 0x903938D290054E5AULL,
+            0xEE42177CB9319246ULL, 0x1B40A7857FABA0E2ULL, 0xDF6EBF21F5E68F23ULL, 0x21A7A80BCBB0EAFDULL,
+            0xECB1C65A05929468ULL, 0x32197C86D131AB40ULL, 0x7669FECF95BD1816ULL, 0x91E2E1C5899EA7A6ULL,
+            0x04EE87F6D702B369ULL, 0x2EE1257634F34C4FULL, 0xF20467AF3FEE5917ULL, 0xB8A8C11811EF2065ULL,
+            0x088DA8B330C24765ULL, 0x4E8CA48B5B88BAABULL, 0x336284ED7A78611EULL, 0xC8D2B09B1E0F165CULL,
+            0x3E04C28677DD1F70ULL, 0xEFD2FB53DD07794EULL, 0x523C59671C32E43CULL, 0xEF8B9FFC9FDC0EF4ULL,
+            0x5572C46207EC8BE9ULL, 0xFEC82AEFB8C088BEULL, 0x16FA7B458ADAE62FULL, 0x863438EC9BF53823ULL,
+            0xF0A1C9D46DAEBA93ULL, 0x2DDA81FB3FC52326ULL, 0x268114E2DD56A0E0ULL, 0xEFB84766F21A35A1ULL,
+            0x86B5CF996CD3498AULL, 0xE0B6681498DBCD99ULL, 0x081C6FAD862E3C42ULL, 0x9D4F2E9CF05130BAULL,
+            0x6B827E22035CFC5BULL, 0x4064ADE969283363ULL, 0xB3E9DCF84010DBC5ULL, 0xFBC166EEF9BAAB32ULL,
+            0xD7E6BFA0BA4D52E4ULL, 0x1B6309DB20B3F141ULL, 0xC081555B09E0E6E3ULL, 0x2BE1D62224CAFFEEULL,
+            0xA23BC21CAEE35191ULL, 0x95122DDEE3BCD372ULL, 0x959CF40847893654ULL, 0x850AE002F1F13138ULL,
+            0x8E39F7B394CD9D5AULL, 0x85EEFC7052E810E0ULL,
+        },
+        {
+            0x3556236AFBD7F8C1ULL, 0xE5094364AA264770ULL, 0xF7E759978DF1D7FEULL, 0x1A1FCBB9F3C20BD1ULL,
+            0xAAFA479086D15B86ULL, 0x6C0436118998D8B1ULL, 0xFD4A247B1D2BE540ULL, 0x221577D01854E28AULL,
+            0xD990C8286293A9CFULL, 0x1EF128F8D93D1D5CULL, 0xE4E8677FA4AFB066ULL, 0xD04C90C1EB0A3686ULL,
+            0x4B27DDF96A57436BULL, 0x335C0B2E4B64572DULL, 0xD0D139C3AD84F4C3ULL, 0xCBD1341E8EAEADEAULL,
+            0x6C89DB4B59C7CA31ULL, 0xB569FE92940AE9E5ULL, 0x3D390603A4482576ULL, 0x1D1DEB21E4DF28BCULL,
+            0xE913CF83061139EDULL, 0x41FD2EC222D2C0DEULL, 0xA577B4346F8292DFULL, 0xE439B0F235D6C03AULL,
+            0xA0CB41B03A7E233AULL, 0xB188BFB8A21D51FCULL, 0x0E6AA8C9D68C945FULL, 0xB1BD9C2281E17AB7ULL,
+            0x7D30985378EEF582ULL, 0x6BA6F4842AC008E9ULL, 0x8E233A2AB6FA92B8ULL, 0xA8ECBEE59C5EC99DULL,
+            0xE5A75EBBFF7BB34EULL, 0x8C4081168F5057A8ULL, 0xB5E06D0146A01D07ULL, 0x338D1A4B1670FCFDULL,
+            0x710DF78D07748244ULL, 0x91F90FE9A4927A40ULL, 0xD77E0B168165CEB4ULL, 0xD3287B081C902829ULL,
+            0x0927B12769D42239ULL, 0x4BB6F6359E32243DULL, 0xDEAADF79E36AEF35ULL, 0x55EA473038A757ABULL,
+            0xAC7F6F49BC7E93C4ULL, 0xA9FAB1C3DD1C1FE3ULL, 0x61D4734FE065BF1CULL, 0x06D9560FB7ED3362ULL,
+            0x0F277AF716AA7184ULL, 0x379D534594E5C467ULL,
+        },
+    },
+    {
+        {
+            0x88FB3679726FF62FULL, 0x0FE1BB6261B54203ULL, 0xE1882C77F0E8C847ULL, 0x5A52A7A9EC1DE817ULL,
+            0xA486DE6469B33607ULL, 0xF05D912EC83B31ABULL, 0x338F421D67424D08ULL, 0x342AFE55D39A8B92ULL,
+            0x626A1B74FBE71A05ULL, 0x3B469C2DE274F571ULL, 0xA555D2657B9560DBULL, 0x80FCBFAFC1951CDAULL,
+            0xBD03E486D80C4063ULL, 0xF3E0A4B81EE62023ULL, 0x76ED6E851A1184A3ULL, 0xB632FFFD7A04EF6AULL,
+            0x7C27F250644E7C34ULL, 0xC921141AC3076DCCULL, 0xFBB0BD25FACD9017ULL, 0xB93D4AC56DB0EEF7ULL,
+            0x493E01A0335AD2EAULL, 0xAF91EC6FC44B9DCFULL, 0xCAA6D9F448F59934ULL, 0xD12D3C025028BF06ULL,
+            0x2F96BE6496B7EFF8ULL, 0xC87C87D7F3D07E27ULL, 0xB28A3A87C9DAB71BULL, 0x1846BA34AF6DA4B5ULL,
+            0x91937C1F4CB4F2BCULL, 0x96A9362FA9F4B459ULL, 0x84222095CBE36B71ULL, 0x3004135AD60E51E7ULL,
+            0x9D1BC31D8302D484ULL, 0xE384C7D9C27B702DULL, 0x7B5A0225DA3C2D8DULL, 0x3349B275B61E9696ULL,
+            0x10731AB49473CE3BULL, 0xF596F3F516A1C767ULL, 0x28B959A01643BD29ULL, 0x8037239411035013ULL,
+            0x31630D1977113273ULL, 0x1718EC477E53ECD7ULL, 0x4D91101724529ECEULL, 0xC9A449BCDD824873ULL,
+            0xAB43EEE2EDE33023ULL, 0xCF42E1D90BF69E83ULL, 0xF4121C0BF16AB37EULL, 0x3F399074197B7998ULL,
+            0xF7D6FC341272E96BULL, 0x950DA904D7333679ULL,
+        },
+        {
+            0xF36780BAA835EE55ULL, 0x6B58EFBE0C46B0C9ULL, 0x96971FBCE83B2FE8ULL, 0xF2F7B605BDB3A3B7ULL,
+            0xDB5E331D3C36C930ULL, 0xC2624A07039EE8A2ULL, 0x5474814F4CD1BDF3ULL, 0x61DC7136D5090248ULL,
+            0x53A4EB95DE32824CULL, 0x36ADAE3CC1F7F448ULL, 0x46B0946E284009A0ULL, 0x031CE1892640E1B3ULL,
+            0xA384EECF61626CB0ULL, 0x4FEC6DBDE27F8469ULL, 0x0F7C8BFF74954121ULL, 0x58716DB700CE03E3ULL,
+            0x704738D3937B0724ULL, 0x7620E4D8FA2CB82AULL, 0x72BA238D0047ABDAULL, 0x1FA3E92FDACC920DULL,
+            0x5EE6566AF4CE2869ULL, 0x28C6F1A3CB528E79ULL, 0x2CAF7E8923E29525ULL, 0x8E799109E93AB94FULL,
+            0x87CDDBA81C957FFDULL, 0x6FD42592D2880A42ULL, 0x8CC81BF3C1CBCAD6ULL, 0x90B354CD7C6628C3ULL,
+            0xA6B0DAAE52A8B452ULL, 0x092BBF8FD1DEB1BAULL, 0x9C592EF32B542259ULL, 0x32E97D8CE4FB3C5DULL,
+            0xBCC1183D5EBC7D65ULL, 0xE3E337E8FD0CFCDFULL, 0xAC27F4BD959E32E6ULL, 0x1F11B848A1637703ULL,
+            0x123091042446112DULL, 0x6B5FCAF91331764FULL, 0x41B8EE48CD456763ULL, 0x74D656DB0BB0556DULL,
+            0xE4F59BFDC611CE87ULL, 0x39D63704D98AACDAULL, 0x7C130F7E790FCF03ULL, 0x6E794603DF54705DULL,
+            0xD91148685C076FFDULL, 0x0722BA591C5F3E62ULL, 0xC50BF629EF58589EULL, 0x161395537EDD0FAFULL,
+            0x768B1450B276BE70ULL, 0x141DB2FDC76BCF0CULL,
+        },
+        {
+            0xBF0FB1EA28D35B92ULL, 0x6B93D755106C59A5ULL, 0x1E3FD36EBAC24856ULL, 0xA5E79C60ACA31946ULL,
+            0xEB0912CEBBFCCEF4ULL, 0x00B6E4F654B40A69ULL, 0x21E85699A428D83DULL, 0x02DC187ACBCB26CDULL,
+            0x4FD3B718EFCCA3C0ULL, 0xAE2BB9332C4DCA87ULL, 0x56B8076DC19310D2ULL, 0x7EBB2DBD98284273ULL,
+            0x143145083D28EE37ULL, 0xF8B99777DEF9D22BULL, 0x4F20A89A23EBCB4FULL, 0x4CFAA350CA052F19ULL,
+            0x2E690517C937C307ULL, 0xD944CDA249B78D41ULL, 0x8B4A4742B559921BULL, 0x69B1FDE3DBEAC7FFULL,
+            0x6D86E1B5A5730DB0ULL, 0xDBB0D328FC1A87ABULL, 0x0E33905E8B7E3864ULL, 0x1FA66C6794C25D14ULL,
+            0x440A8A7E19821CAEULL, 0x92D64E9B208DF317ULL, 0x1A0C377A11B0CD31ULL, 0xFA9793AB11D0C0EBULL,
+            0x601763CE5C8A3BAAULL, 0x67693E9EAF72855DULL, 0x7D77A2EB30089717ULL, 0xAAFF7C3CB15DA3F9ULL,
+            0x72744D92A6D4C6FEULL, 0xD0C4C9948F9110F3ULL, 0x20C9757EBCF06E12ULL, 0xD1308F05E4CC4A4EULL,
+            0xE6A7394657EA815AULL, 0xD9340FC0F47E42D8ULL, 0x4AA6CDD7B2E7085DULL, 0x95C2896AA751710DULL,
+            0xC11112FFE93C30AFULL, 0x0687CDE8D9EB830EULL, 0xB834A6CAADC95788ULL, 0x7D9EE8F92E782727ULL,
+            0x3C98433FBB9BFEA9ULL, 0xA2DEF0A8DBEE4314ULL, 0x84370F550C8FDA92ULL, 0x4E24E9FD3D7C21A7ULL,
+            0x232140BABC725024ULL, 0xFD15442EE4923D84ULL,
+        },
+    },
+    {
+        {
+            0x26200D442B9AF8FFULL, 0x1589ADFF3FF012CEULL, 0x6D5C59303D04816BULL, 0xB3EDB2CAE921B2A9ULL,
+            0x09DD83A5F5D27B8CULL, 0x661164C8FD20BC7BULL, 0x9D290D6F34FC83C3ULL, 0x79B369BC91C5EA04ULL,
+            0xF04BBBCBE57C60D0ULL, 0xC3E9E183F996AC11ULL, 0xA53EB115045EA509ULL, 0x2081F30119587A03ULL,
+            0x39C897E2165A2A37ULL, 0x5264BFF6E6FCF3A3ULL, 0x6BCF031C2F718284ULL, 0x354429C17A1D4081ULL,
+            0x4C0351DD23297A40ULL, 0x2ED27CA00D11B8B4ULL, 0x82748D1E53F936C5ULL, 0xC02F86781C1BD5E8ULL,
+            0xB9606427A0ED9843ULL, 0x06BB969E00A433B3ULL, 0x78CFA1987DF7F714ULL, 0x2310CB5C75E75DFAULL,
+            0x5CD90DA204E6ADC1ULL, 0x52DECE5CCD4830DAULL, 0x70B73CD18CB3D63BULL, 0x38B9A46DC7365F57ULL,
+            0xE548413816970629ULL, 0xD66FDA1027748265ULL, 0x27F111EFEE145221ULL, 0xEE2D08C49B12D2C5ULL,
+            0xAE88E9004088E620ULL, 0xD3694D3B812C7FECULL, 0xB9F3C4FC8AEA5C13ULL, 0xDAFB88DF5A3CEC6BULL,
+            0xEC084F2228D8EF73ULL, 0x407D5C948386E26DULL, 0xCCC33D943EA6D4E9ULL, 0x184F92D363F38300ULL,
+            0x4161463901B8A406ULL, 0x3CF138E6208E14CEULL, 0x55C63CA9FB1DFB67ULL, 0xD8EC043E225BF951ULL,
+            0x77307863C20D3AE3ULL, 0x88883B15D137F856ULL, 0x2697C4F3CC2D4226ULL, 0x83ACBF4E2AE55122ULL,
+            0xF5A0BB6783C09300ULL, 0x441A8E8E0ACFD226ULL,
+        },
+        {
+            0xA770679C576E0402ULL, 0x7F82032845D5988AULL, 0xB49363D7715F513BULL, 0x64969A7AE0FCC159ULL,
+            0x5D6511A52F104E9BULL, 0xD0F04632F902A8C6ULL, 0x33C767A4316C5C17ULL, 0xD218D57C6B45616FULL,
+            0xA46FEB684E3C506DULL, 0x9765D019BCA3938DULL, 0x79B980DDFA9B97EAULL, 0xBED2511DA1FC1A45ULL,
+            0xF8C8CB0BC093D331ULL, 0x2095F37FB82E18D7ULL, 0x7F22EFF7AD8E9126ULL, 0x667C44D8F85D0584ULL,
+            0xC5F369DC43425E8FULL, 0x4977B172536699F2ULL, 0x2FF632586DDA6841ULL, 0x635788BB3F31ECD1ULL,
+            0x4E631FDE8E3E9B48ULL, 0xD2C9205F0711347EULL, 0x7D57F287C8F1C996ULL, 0x891C81CFDD2A8F85ULL,
+            0x782B83196E779BDAULL, 0x774C5BE7B6ECC26DULL, 0x650879981BAE20A9ULL, 0x72DF0410E95476A8ULL,
+            0xD5698594FBC47445ULL, 0xBDA3F795367C4DEDULL, 0x2527E684D6D26E36ULL, 0xFD08DEE328F6876AULL,
+            0xC20D155DE223F0E4ULL, 0xA8F0BA45B30D0E05ULL, 0x46BFC9EC305A3559ULL, 0x280C3B4156FAF773ULL,
+            0x1D40B1B448BEBE5DULL, 0xA2C564453089F461ULL, 0xBDF015E3198BDFC9ULL, 0x624D6353F2DA1A36ULL,
+            0x69DE12CD67FBE382ULL, 0xC84C4E371636B4C5ULL, 0x3259FFF6B2F748ECULL, 0xC24A714131A71D7DULL,
+            0xAACCE08261A2AC07ULL, 0x1D6FA57B4974089FULL, 0x73898A232D6B274EULL, 0xAAEADE729011E280ULL,
+            0x7A165F5A8F936145ULL, 0x59F5904CDFF2B6C7ULL,
+        },
+        {
+            0x0D602BD5E8EC026AULL, 0x4FC15305F9AC00EEULL, 0x3ABA9D6D5F9CA36FULL, 0x5822F43EB5B4A1E9ULL,
+            0xD7320B58141E92EAULL, 0xE0E55856DB51554FULL, 0xF30D4C0C00514425ULL, 0xF1059C96BB5E4FEDULL,
+            0x88C775E7D822A832ULL, 0x954BED8309FAA1E2ULL, 0x1E60315FFD3F6C21ULL, 0xAAB0985195E83AB9ULL,
+            0x07BB488D8282648CULL, 0x342F4633F305C345ULL, 0x091731D49EFDB983ULL, 0x1C6D8673BBFE4230ULL,
+            0xC02660500E3732B4ULL, 0x7E9FB237261371D1ULL, 0x4179A12AA45D0372ULL, 0xED22C03C0DD325F4ULL,
+            0xA245C07B98C17EBFULL, 0x5674C6F4177CB382ULL, 0xEE107C8E62C4EA65ULL, 0x872C1759E7955AF1ULL,
+            0x4E349159C25AEC04ULL, 0xF126E38B0B5DD8DCULL, 0x76C7CFA8D9FCD46DULL, 0xEC506AD140FD9685ULL,
+            0x4C5E89D9B6196CE8ULL, 0x7496290266D16431ULL, 0xA2F2FC942FB1EAB9ULL, 0x8FBB1416D89B072CULL,
+            0x95D4DA87474A7A22ULL, 0x7A8C923698B22656ULL, 0x425EEE22B2F4179AULL, 0x84BC1DC27A0D5935ULL,
+            0xB347F7358B07AEC7ULL, 0x4489AC9C3496F05AULL, 0x4D4DF0CBE13C8B3AULL, 0xB959748351E37CACULL,
+            0x8FE20C9662A01155ULL, 0x8D6BE9D4AC25A437ULL, 0x4CE0AF8CBDEC02BFULL, 0x6D21A5C07534957AULL,
+            0x694ACC99EFF4E2D0ULL, 0xB5B33816C363BF15ULL, 0xD460006A7BBE1D2BULL, 0xFEC2935514C94BD1ULL,
+            0x6EAE2A3FBFC40D06ULL, 0xB6476E4CB920049CULL,
+        },
+    },
+    {
+        {
+            0x920D351BAFEAE395ULL, 0x0C096099D85B7312ULL, 0xFE11498F11BD4174ULL, 0x03517B2E050CE6F6ULL,
+            0x899DDF3B839782BBULL, 0x8631985927DB637EULL, 0x27E6D79C9B53CA38ULL, 0x201171DEC888E3ACULL,
+            0xF50A6B377982996BULL, 0x030214FA69C8A699ULL, 0x87FF94B398C9B194ULL, 0x1D48C3287448C7F7ULL,
+            0x2953CAE4B91F4BB8ULL, 0xD656FEEDE8969B2FULL, 0xA369DE71FE369DD9ULL, 0xC57E29D90E92A6A2ULL,
+            0x04731BFF9A2C6B6FULL, 0x851437B5739D0879ULL, 0xBA0FE29B47650C29ULL, 0x20162138D1CFEC71ULL,
+            0x57170545B1CB4FE9ULL, 0x2EE48F1627EA0336ULL, 0x308125FB0423DAB0ULL, 0x67FD3AE3E3813105ULL,
+            0xC91DC04B4664D227ULL, 0x725B26E6371E7243ULL, 0xC9210A8C8E6ABE67ULL, 0x1D4ECE5D7FA312DBULL,
+            0x13D8F4ED4BBF823EULL, 0xA31CCA3EEBFBB2BAULL, 0x78F19C404829AB5FULL, 0x8730891E682ACFC9ULL,
+            0x52196DF3979C4816ULL, 0xDD246C7974AFB506ULL, 0x78D8A27F8CD36BECULL, 0x96CA2999461BB63BULL,
+            0x34EFFA225B936F97ULL, 0x0659CA280F1D4C88ULL, 0xDBDA91DE99E35411ULL, 0x883CED685B75B6F9ULL,
+            0x9E2F052967D9C3D4ULL, 0x0574CBB9F1BA0553ULL, 0x79F0AA8127404599ULL, 0xF292342CFB088352ULL,
+            0xBD4965737D1C06D4ULL, 0x194E7CBF4B8F0BD9ULL, 0x9ABE49A6B0BDC38EULL, 0x46315F355DCF9B89ULL,
+            0xDBC734A23A1FC6FEULL, 0x9725D78D0CA386F3ULL,
+        },
+        {
+            0x906543FF74F91D3EULL, 0x081FB7DA56F86084ULL, 0x96E7944532D73145ULL, 0xBC503AD737986E67ULL,
+            0x29442DDC3CD6277BULL, 0x0782BE801E2335F5ULL, 0x608FF8E7ADD0AEDEULL, 0xC8222DB1F37D7803ULL,
+            0xFB7CFA7224A3E233ULL, 0xD3CDF333063A4937ULL, 0xE4D78BD687489065ULL, 0x1695D5549A64B805ULL,
+            0xDC4F42699D14D035ULL, 0xDE3B571038B654D5ULL, 0x70FD1D37A5B0AD3CULL, 0x6E5838BCB5BB0366ULL,
+            0x0B32B5AF1BBC6CE0ULL, 0xEDD6166D7F7E2C39ULL, 0x32A6F1E843CEFE21ULL, 0x7187B0072808CB9DULL,
+            0x31D0219F078D9D4AULL, 0x3850D47540AC94F0ULL, 0xA3ABE7B5F024F1D9ULL, 0x18E7FA85D037EE7AULL,
+            0xBA7C794495EF5F26ULL, 0xB1635BC19CC78818ULL, 0x66BCE0B7DD0F0108ULL, 0x651F6D88AB405D0AULL,
+            0xC19DE750DFC0DF30ULL, 0x5B2E380CB0B2928EULL, 0x7F9A5F0BFF70942BULL, 0x995B9AF819A81FC3ULL,
+            0xCA2D90373E1CDF3CULL, 0x3AEDB87A1FB4A982ULL, 0xF00E19585333E051ULL, 0x8173FFD734C5B3D1ULL,
+            0xE98E3008C456ECF6ULL, 0x42760D2464A5BCAFULL, 0xCBB2419FCABA3C16ULL, 0xF5F483FC07FE8DEEULL,
+            0x4F4BB6DA4705CB75ULL, 0x866EC8E9F0D1BDA3ULL, 0x7DF150C80CDB1618ULL, 0x54A4107984AC2634ULL,
+            0x3A5DC6793E9A7378ULL, 0x0B458C401728999EULL, 0x90C8899E90496F2DULL, 0xDAB9888FBFB196B3ULL,
+            0xB571D37D0CC1395EULL, 0x12018D7AB8E52CACULL,
+        },
+        {
+            0x2C4C25464AA04DF5ULL, 0xE221EAFBC7C4D02EULL, 0x008ED9D27F66920EULL, 0x24265FE8E9291CAAULL,
+            0x0694561A190F2413ULL, 0xFB6CAFFD37405E9BULL, 0x304002D3272618E6ULL, 0x958D451ED15CAD57ULL,
+            0xB9429EF46DE5A1CDULL, 0xBD95BBB13BF3B9CEULL, 0xBD1BFF510829ED3DULL, 0xB8A506223EAB51A7ULL,
+            0x1EB8F719A7BE8EC4ULL, 0xE888217C2F38C2D9ULL, 0x3ADAE9C84B35251CULL, 0x29F343FCA2E58856ULL,
+            0xDD11699E7E4496C6ULL, 0x37F661909D936E6BULL, 0x0FBE91BBD150B277ULL, 0x2CBF316639366ED3ULL,
+            0x685E3BA7D899D6CEULL, 0x841F823CA64296E3ULL, 0x39029C368B6BCB0EULL, 0xE1D3CE1D7BDE1F18ULL,
+            0x1A68AB3EBF016526ULL, 0xCB5F3F22F25AEE6CULL, 0x03B4EE3BFDA840B0ULL, 0x7214A60790373C31ULL,
+            0x1E4B1615894C7E09ULL, 0x14944972F7EA44B5ULL, 0x5BC023A49AFA1D7CULL, 0xEC3F8454426B3646ULL,
+            0xD08E4BD475BEB1AAULL, 0x4015E570A85EE649ULL, 0xF275836651F4E9C5ULL, 0xB5098161DFF9D156ULL,
+            0x67F841DAB6F0B774ULL, 0x4D49C396BF6A0B1AULL, 0xB17771B9BAED598CULL, 0xD32D75971981603FULL,
+            0x2E705E5161938D3FULL, 0x28FEAAAFDDDE05E5ULL, 0xF33C6D06F40460AEULL, 0x6BA36322733F83EFULL,
+            0x41F6B396C614E728ULL, 0x51AE870AFB8804E6ULL, 0x0FDB5E0ED63CED6FULL, 0x075303CC87EC2F75ULL,
+            0xEBCA061A74D08A6BULL, 0x1E7D90BCC628D1BFULL,
+        },
+    },
+    {
+        {
+            0x15E08327301F0FDCULL, 0xDE525D6015C146C3ULL, 0xD21AB9A1A47F148EULL, 0x244CE4F2082D0927ULL,
+            0xB8DB8C0BB3B1FAF5ULL, 0x57DAA0647F768440ULL, 0x047AF69748317948ULL, 0xC541C402D6A249BAULL,
+            0xC7EC78BF75F823A9ULL, 0x8A3283F0423219AEULL, 0xFEBAC8AAC13FD61DULL, 0x39B88CBB3C698EF1ULL,
+            0x41BF77B9E2F4C1ACULL, 0x18F7B319326AC32FULL, 0x97B439C8B8093D69ULL, 0x79842DA2A63D5553ULL,
+            0xCEE7948BF0FC1B39ULL, 0x328CB1B941E20D4FULL, 0x789EFA20FF617A95ULL, 0x069BC32033D3BD20ULL,
+            0x0BA3DB2E544B525AULL, 0x4B2F7D7C5480127EULL, 0x49CEEAC715D64DDAULL, 0xDD656BC68857D7C1ULL,
+            0x738E552CBA16A82EULL, 0x938CF2702E314EFEULL, 0xE96BA59BCC2753E3ULL, 0x47AD5D88131F8584ULL,
+            0x236C0F8483765B8FULL, 0xEE729FFAF567B4F8ULL, 0x095F852A24DD4591ULL, 0x906CEADD99C3BB5AULL,
+            0x63817DBD702DAAACULL, 0x3091D7FA0100DAF9ULL, 0x9F9116232473450CULL, 0x0CBFF4DED7476086ULL,
+            0x3F14C82848AF0FC7ULL, 0x622246B552354018ULL, 0x20F53EAE44F22C98ULL, 0xE996751BBCE1EEC1ULL,
+            0xF67E74F5F483BD5CULL, 0x2F739BAD92626D26ULL, 0x17DA1D405C81207CULL, 0xB1214202A207BD3CULL,
+            0x308E76782B877D46ULL, 0x1C605AA111DFE23CULL, 0x37CDA0ED7DB352F8ULL, 0xDC5CECC2B5798A5DULL,
+            0x27758D6DC3284E09ULL, 0x9D30339BA2D6BCD5ULL,
+        },
+        {
+            0x18E82E03FE7E84ECULL, 0x1FCD6C123374C2E5ULL, 0xDB7B10D4363E3220ULL, 0x126CFA0A5B12C644ULL,
+            0x58224DB1364DF2C8ULL, 0x96EBB1A7CF5EDB2DULL, 0x0CA7EEFA97A50DDBULL, 0x6A76199288725100ULL,
+            0x280D37A01092F5A2ULL, 0x005692ACDB28F8C9ULL, 0xCC13A0A92149BB78ULL, 0xAA64A59CFA16F60EULL,
+            0x17FDA596A85A9862ULL, 0x7EF06F3C2B0475D2ULL, 0xF8E1FC628F8749B9ULL, 0x2B71F23350A9096AULL,
+            0xFB318DD8BE9741F8ULL, 0xD5630B3460F3117BULL, 0xAD252197C5EBC999ULL, 0xE43425DA5935584AULL,
+            0x800C6791CB2C607AULL, 0x4874FD1363D9663AULL, 0xAEEC034AAB6C1A76ULL, 0x97CE906E59F69FC2ULL,
+            0xFE848BD3AFE0C27DULL, 0x6886D25391B23CB9ULL, 0xC1E30237B0895680ULL, 0xDF7B11151F37E42DULL,
+            0xBF0F097C453F20A5ULL, 0xDF2CEC0BB921D7A4ULL, 0xC21B79BC26C4FD0BULL, 0xE54A44B0DC755631ULL,
+            0x6387F33C2BE410DDULL, 0xF183E7F4B7D44FBCULL, 0x9BBFCF5332198823ULL, 0x6615447584FDD3F3ULL,
+            0x490116FE83D6B494ULL, 0x9D1BC0D42414BCFDULL, 0x69777B060B640AC4ULL, 0xAD272B4FB88AF3D1ULL,
+            0xCB12F79C3FD13276ULL, 0xF1C719DF4E88CD92ULL, 0x01059EC7BA86F889ULL, 0x153045FDA52CF738ULL,
+            0xC0C1F9C24A1060D6ULL, 0x79C4CEEC2DA8B597ULL, 0x12466B174B14613CULL, 0x4878920A214186FEULL,
+            0x11910EF4A15B7A73ULL, 0x3BFBE6F811073047ULL,
+        },
+        {
+            0x1D8820D2D92FCFE7ULL, 0xA7A0C225DDE289B8ULL, 0xDC4ECEF2FA9A22ABULL, 0x649E4BE745EEDC2EULL,
+            0x608130B3BF7BCA16ULL, 0x95BE96B88FB17802ULL, 0xEF672FA089145A72ULL, 0x3B7814425AD2AE46ULL,
+            0x46CFC1AE8A305A9AULL, 0x7615440AE93FDCAFULL, 0xBD17A001992368D6ULL, 0x3182C3A008DFDB87ULL,
+            0x375827AE4FA865F0ULL, 0x58C55EA767E6493BULL, 0xD089A2064F4EAB69ULL, 0x17707317DDE9CC7FULL,
+            0x4257CEE671E0E027ULL, 0x974BA4A44971C827ULL, 0xC5BA5AFAE07BC277ULL, 0x16082AF2E3634833ULL,
+            0xA797B49073B7E263ULL, 0x3281345BA82A7567ULL, 0xBF9AE34B6BD1984DULL, 0x306E1DFE2A13883DULL,
+            0x042C3C492378006DULL, 0x268E8C70F9694B2DULL, 0xD21845228E5AF2FBULL, 0x02896B8B301999DEULL,
+            0xD481DBDB29FE1D6DULL, 0x79170C9717A91A17ULL, 0x52C904BAAB442DE3ULL, 0xA859F83AF055BD78ULL,
+            0xA0885596B7714802ULL, 0x479228E5BB69EA12ULL, 0x07E4ACF86DABFD46ULL, 0x3F404641FE5F3B3CULL,
+            0xE515736C999ECA4AULL, 0x68D1ED33B4EA255EULL, 0xBCEE2FDB60896694ULL, 0xAB7CD8CB7A715159ULL,
+            0xC9D1C91FD18CC5BBULL, 0x5F83FC1BB049D2F0ULL, 0x364DD50155A9FD55ULL, 0xC56221E5B5095BEFULL,
+            0xD48804FAB2785298ULL, 0x2D9EDAA6DB21043DULL, 0xDCA56962ACBBE975ULL, 0x2C725AE0FDF863E7ULL,
+            0x544A851A5BA78AE0ULL, 0x3F04F2AE8C447DF5ULL,
+        },
+    },
+    {
+        {
+            0xA2D31E9A1F61284EULL, 0x7B1BF1F4A520399EULL, 0x5A1B2935BF8DDE6DULL, 0xF4B0FD68716AFE91ULL,
+            0x7B8C8168FABDAF2CULL, 0x5070BE8E0F229F72ULL, 0x3C072D7E05ED46CCULL, 0xA02BE8C574ECAF41ULL,
+            0x9D2181595C78865FULL, 0xD3577FD7E10C0093ULL, 0x8D37C34935785C52ULL, 0xC5EFBD32025BF86AULL,
+            0xEF2A71DBA598151AULL, 0xEE97CB88311523B0ULL, 0x17AA80A20BA7E5F7ULL, 0x3F9B09BB350F37FCULL,
+            0x3198FB6A4B715693ULL, 0x9C688BA0889C70FEULL, 0xCB0A629B0FB0B79FULL, 0xE48037886111D130ULL,
+            0x500FC6DE72A5BE92ULL, 0xE8B20161F223116FULL, 0xAF78B5060234EC8DULL, 0x33FFF89E12B20614ULL,
+            0x080E67150CE46718ULL, 0xFB6C390A40AB69D6ULL, 0xAB4FCC6806C08A85ULL, 0xC035A657621F0AD0ULL,
+            0x1D17E007ABC980C5ULL, 0x967DF69963EE8284ULL, 0x265D72E387DB7E81ULL, 0x8928B3AA49A3483CULL,
+            0x1CB578A01FBD81ACULL, 0xC184380F238911AFULL, 0xE9852CB9ED27884CULL, 0x26F479138EAE545CULL,
+            0xE12A358CF7459FF4ULL, 0x9EB184565FA469CBULL, 0xDD1C174DF08833D8ULL, 0xDB56DC33E460D5BFULL,
+            0x032C03ABB6829BD4ULL, 0x0D7DE3F6C5F5EBE3ULL, 0xCA1CEDCFD99098F4ULL, 0xEEAA3EE6389104C5ULL,
+            0x802BF4749F21B78CULL, 0xA5E73C58A74597E3ULL, 0xA32A1BC47D8A840CULL, 0x8329BFFFE3591204ULL,
+            0x6B983E24AADBA120ULL, 0x48D650AD9D865E62ULL,
+        },
+        {
+            0x4A70BD16785A8A5EULL, 0xF09BF07FC2D768CAULL, 0xCFE3EB160CA7B49BULL, 0xE24BD75685A4BD32ULL,
+            0x124BE9A027B6F8C8ULL, 0x4AB9B8311B2CA739ULL, 0xB580A9CA06BA1037ULL, 0x946666A46D9B89D7ULL,
+            0x4581EBF164902B04ULL, 0x09D5768B33974A52ULL, 0x97FA4A0949E4B046ULL, 0xF4E17D54E51FA8A6ULL,
+            0x36948A6202C57E77ULL, 0x51CACB0DCAC7894BULL, 0x41D90783F8AB3499ULL, 0x35244C6F7A6464B0ULL,
+            0x5D1B925AB1ED8079ULL, 0xE4D1FA2D05936539ULL, 0x3E77DDE60C802DB3ULL, 0xD0DD4006A7742128ULL,
+            0x27AFC9EEF5C3836AULL, 0xB9DF6233157D9EECULL, 0x30090D47224F5ED1ULL, 0x443B02D07C5E542CULL,
+            0xBAABCC2DC6BE6384ULL, 0x928FD5A5025D7E43ULL, 0x6EE1E2991830347FULL, 0x1A2FE519772CABD7ULL,
+            0x4397E54ED512E740ULL, 0x3966E24175F5128EULL, 0xC628C1711E5D9B2BULL, 0x01455FBACDD88ADDULL,
+            0x6FFCDC79862A2C88ULL, 0xE3507F1D0F9E5AD1ULL, 0x9FCC8BC8FD05F224ULL, 0xF029D8CF7247F0C0ULL,
+            0x677350641D054F21ULL, 0x55A357726676ADFFULL, 0x3C2414D67466DF64ULL, 0xF01F92448D614BDAULL,
+            0x598D474B0AC83FCDULL, 0x2C3ABC09D0CFFCF2ULL, 0x9974EF0230191F8BULL, 0x043BA3CC4F27AF74ULL,
+            0x2C5B790591E8BD2AULL, 0x3AA0D22C3AE166D0ULL, 0x1F1173F4D62D101DULL, 0x5CCB1B6ECC3CED7DULL,
+            0x2100890C54FE6BE7ULL, 0xB3683CF7A3518EF0ULL,
+        },
+        {
+            0xFF8676598A7091EDULL, 0x8A1CB362E061AB8EULL, 0x01281FC49E084B59ULL, 0x58EE1586C753AD8FULL,
+            0x7A86A7F979AF8914ULL, 0x589F58E537901306ULL, 0x4132CEDD7EDB32A0ULL, 0x7F509AB84D342CC5ULL,
+            0x54AE76435E85D5DCULL, 0x3803564491182977ULL, 0xF5B0E5D212D4A4E5ULL, 0x8D579C4EBE9C94ECULL,
+            0x9037DBB83BD316C5ULL, 0xD161E6089EE9A1A8ULL, 0x8407B72C305F18EBULL, 0x988CCC8C64D0FC1AULL,
+            0xF433D5DC61611B62ULL, 0x1D120C51212141D4ULL, 0x6C6ADE360FA7F657ULL, 0xB839AEE2EC79CC7BULL,
+            0xFDE824318C1B4123ULL, 0x6BAFCA773F355F61ULL, 0x4C51802B2CCECD9FULL, 0xE45F6D563F1FD7C4ULL,
+            0x8A271D399CBA996BULL, 0x34B40AE23F3AD699ULL, 0x8FBD43DB25CA2574ULL, 0x71D0E0607DDA6C3EULL,
+            0xC10E5A7EA8F11766ULL, 0x12A99A6D9299ECC8ULL, 0xE17A44D3087CED11ULL, 0x639DBC7DCDE3708BULL,
+            0x962E60A1C9E1F4AAULL, 0x00D3B41A771C5DC3ULL, 0xC0A445B6E42D75B8ULL, 0x3080E41FAEA94153ULL,
+            0x038930F55DAC2711ULL, 0x4D30058F6EC29B1FULL, 0x9A15CC33E00839E9ULL, 0x0D7192A4654F73DAULL,
+            0x9738747527585BBDULL, 0xE2FB9DD058E3A44AULL, 0xBBA07D85D7363182ULL, 0x78A348A52DE67D61ULL,
+            0x141321DE4238C9DBULL, 0x005C6B2134A5AE88ULL, 0xF67FE9C265DC47D5ULL, 0x5F3717CA4AC8AA1AULL,
+            0x38E9304782A8FDCEULL, 0x19F973C487411FB5ULL,
+        },
+    },
+    {
+        {
+            0xF63B1B175C6AD0CAULL, 0x12852785DDA977EBULL, 0x5908526DED3ABFC4ULL, 0x9BC93B7A58C1BBBBULL,
+            0xC4DA6A51C771B60CULL, 0x6CB66EBC22935660ULL, 0xF25400A44557E8CCULL, 0x609943634D04F41DULL,
+            0xC94868D6E14A5AB5ULL, 0xE6F6BB07D3C8C340ULL, 0xEA0D019333BB82C6ULL, 0x78FC0FE283E28443ULL,
+            0x46B182B98DDA318BULL, 0x8AC2E29DC02C8728ULL, 0x2766B8FD48241426ULL, 0x362D91B11229958EULL,
+            0x8C34152102936525ULL, 0x24BE04CEDDB5AAAFULL, 0xC462A0A58C458A3AULL, 0x6B4833FEF824CFAEULL,
+            0x6BAAA906CE70ADB1ULL, 0xF6A5F0CB4B2500AAULL, 0x89148950F4B0202BULL, 0xCDDC104128022AABULL,
+            0x751C423027F1E43EULL, 0x1827FCC217ACC876ULL, 0x64E7023579734C66ULL, 0x592AA3FDC022737EULL,
+            0x6ED34B6C2D612818ULL, 0x610AA3B850E2EC48ULL, 0x90F9D81532513B90ULL, 0xBBEBDEB150C77DE7ULL,
+            0xDF3C574A39BD6ADCULL, 0x21C465C321DD2709ULL, 0x5FD011978A387F07ULL, 0x177B6CB778A12E39ULL,
+            0xCB506F1D9F96C225ULL, 0xB19389ED149FC6E1ULL, 0x2F7F541ED3C3612CULL, 0x2A8392482B452CEEULL,
+            0x5C669D8475AB5D37ULL, 0xF0E7477430ABA64DULL, 0xBDFEDF360268C241ULL, 0x385FF76CAB1EA385ULL,
+            0xCAA9C5EADE94DF82ULL, 0x9DF8DCD8989456BDULL, 0x97C4049B64C77150ULL, 0x9ADEDD22DA9CABB2ULL,
+            0xA7032997D1BF3E65ULL, 0xA3BB5C3984AD7959ULL,
+        },
+        {
+            0xE146F3D7D80755EBULL, 0xDECF49781FDF4180ULL, 0x23A26A17CE069F03ULL, 0xCBDC354AD62732FDULL,
+            0x474DDD61EBA863D8ULL, 0xBAB1BFED4422C51FULL, 0x92D9123780122755ULL, 0x0A1D831343C7765BULL,
+            0x9271E01166B80E77ULL, 0xF990FC2FECEE03ABULL, 0xB0BBBA35E21A556CULL, 0x3E8677B7306ABAC6ULL,
+            0x10A257612F9A1E33ULL, 0x86147F7EC51AC6CFULL, 0xA8CC1D6367FCA082ULL, 0x49C92569B88D3943ULL,
+            0xD9070568C87813F1ULL, 0xA967437B7ABE3F96ULL, 0x3963F41828E46669ULL, 0x26A26A2484AB14E5ULL,
+            0x05B83CB332E3DB8CULL, 0x0E9F285869777F3BULL, 0xF03BDA0615973F05ULL, 0x5766D9A37BE5703BULL,
+            0xAA2EC721C27FD41BULL, 0xA70EA38A7E6B4D73ULL, 0x54A6204AD7B8A729ULL, 0xD91F55FEC0953C27ULL,
+            0xAA28B34840E1FF9FULL, 0xCD7C97FAA0AC3BA0ULL, 0xD7ED3747EE398BD7ULL, 0xF3CC7CEE04FDED00ULL,
+            0x42BBAB57F79B56DAULL, 0xD9A15FFAF99496F7ULL, 0x8A294BF03FA8E21AULL, 0x672BB1C5C310755EULL,
+            0x4E582BF50648C234ULL, 0xC7E40A4EDB525EB0ULL, 0x532D39CC75BF560DULL, 0xC9D64E957F820BE1ULL,
+            0xD14B01A05BEFD7B6ULL, 0x598DC07E51692599ULL, 0xFCCEA824B015B192ULL, 0x7D2D3E0D36C9BE71ULL,
+            0x589213EE8B9F914DULL, 0x20EA9B92F91B5D2FULL, 0x990E160F7131C055ULL, 0x94CA508B36831695ULL,
+            0xDF0945C5C90915F8ULL, 0xC864DBDFD1C779D3ULL,
+        },
+        {
+            0x6CF0FEA53740E3E0ULL, 0x5239722885249A27ULL, 0x481686D07BEABAD3ULL, 0xB881FD6D0025BB66ULL,
+            0x8D84CD9CB707E990ULL, 0x7F8A5089B6278243ULL, 0x94F3E947A7ED3D87ULL, 0xBF0A433BB825663CULL,
+            0x2A2D3BC12D2B23F0ULL, 0xE4FEB7D792A989B7ULL, 0xA87300B908105764ULL, 0x1A04000A296D2ECAULL,
+            0x046AC8F7CF830617ULL, 0xEF05995B6BA965DBULL, 0x0F1A9EFE583C21D0ULL, 0xE2D8802E74982D93ULL,
+            0x1B78E3B039D81908ULL, 0xF584A05BFAF8EB3AULL, 0xE0391C1BC688946CULL, 0xE23B93597D251E44ULL,
+            0xAA785724AFA04578ULL, 0x5777F7D7B1A55BF2ULL, 0x9F1FA23D8764ADC5ULL, 0x2E67C307DB45B5DEULL,
+            0xBB945054A14F8935ULL, 0xC216AC665C07FB67ULL, 0xB1E78F72F48FCD51ULL, 0xC408543F8629A68BULL,
+            0xB874348929913706ULL, 0x89A8294650BF14E8ULL, 0x48B7C01BB0C450C1ULL, 0x0F0BA63CACE9C820ULL,
+            0x2CB6064AF1A613B0ULL, 0xA03A39A1A899B397ULL, 0xC797E706F1B68530ULL, 0x958555E70926A43AULL,
+            0xB013739F15FEA7F2ULL, 0x7FD951074CF8E63DULL, 0xC2808AD711FD38B1ULL, 0x6A0F1334FA86CE80ULL,
+            0x3780895C2D2A631DULL, 0x93277DF632BD509BULL, 0x6DCD3FE8026B6CFAULL, 0x7410158DAC6DC4A3ULL,
+            0xB0CCCAE0BB0457EAULL, 0xD1B59F0EFA10E5C5ULL, 0xB308160655F9154EULL, 0x2AAB467CEC7674E4ULL,
+            0x666B9F1B84B5210DULL, 0xE9078BF96ACBA80FULL,
+        },
+    },
+    {
+        {
+            0xB792E806E6CBDC9FULL, 0xCA2B54733BAE8CE6ULL, 0x5325B6ACB718287FULL, 0x64259AE8E2ADE7EFULL,
+            0x39B63E696B2CA7E0ULL, 0x35D22974EB7106AFULL, 0xEAF8B115A0F7AF62ULL, 0x9F213662F2C9D8BCULL,
+            0xDD49CE707657E40DULL, 0x7B3930BC2EC9E885ULL, 0x8D8B5BF22DD6FA14ULL, 0x0FD03296C6B152E0ULL,
+            0xD6B935FD7DBE8845ULL, 0xDF1AE4A0B1C54415ULL, 0x5C73BD97FECF6BDDULL, 0xAA03DFEDCB07A24AULL,
+            0xE4DDD020DA2C7F8EULL, 0xAF83461F969404F1ULL, 0xAD872DE8ED5630B8ULL, 0xC0EF1A0DCAA5B2D9ULL,
+            0xDFD6621111FF6FFCULL, 0xC2EE2B5F7DBEEE23ULL, 0x99482D1587447B3FULL, 0x0C5EACA14A21DC09ULL,
+            0xF9A46669C0A1BDF1ULL, 0x6C0195224965A2CAULL, 0x7175563BD6D89B0FULL, 0x4B7740DD17C009F9ULL,
+            0xD5E88244F386D7AAULL, 0x7C33DE4EA02B7085ULL, 0xFB4B4D1017EFA724ULL, 0xA928ECE85A19316AULL,
+            0xAD14D9FC19DC1988ULL, 0x2EA327C392AEC3BBULL, 0x8CB52FA547B410FCULL, 0x21A9C01CED9AC7DDULL,
+            0x0BB0DD03A02FA512ULL, 0x0098381DA594FED8ULL, 0x70F873C0A6716125ULL, 0xB1FC4942420F6AA7ULL,
+            0x6AA6F90BD3613DB2ULL, 0xAC2EFA1C9DACD349ULL, 0x157F18EEA49478AFULL, 0xE447AE49E4EA9B9EULL,
+            0x0E4FB21DCCA46929ULL, 0xDEC0B59AC4744BBBULL, 0xDC7FC1FC3E412DECULL, 0xA978212EDAA554B7ULL,
+            0x2F1A4829236FD3DEULL, 0xC3EBF3D027543BF9ULL,
+        },
+        {
+            0x15437E024EF74DCEULL, 0x19100DB33FAA10D5ULL, 0x55B2C4055223D1B4ULL, 0x18135E175C6B7B17ULL,
+            0x5ED4182E172D8821ULL, 0x2E961BB5C787FB71ULL, 0x283C0733A31608C7ULL, 0x26E446222AE6F516ULL,
+            0x298C50217354BD7CULL, 0x7FA188D2E53ECB06ULL, 0x099D0F90B806B710ULL, 0x247D5AD3B2C57E7EULL,
+            0x4B9D74B35D34AB02ULL, 0xF696CEA3666C42D4ULL, 0x614840FF6D48AF51ULL, 0x6D9CAAAB40CDCA4FULL,
+            0x5B5769D9D841221BULL, 0xA3E83580D2C4469FULL, 0x9B1D4AC0F90789D2ULL, 0x8CB64F10ACAFB241ULL,
+            0xA1BE5294EA985D65ULL, 0x478BCBB547C8949FULL, 0x0D950269491DC276ULL, 0x9ABB527F2C55A472ULL,
+            0x4C21B94ED49E53BAULL, 0x9DCB3AB327EEC19DULL, 0x328CA0B7D49EDB5EULL, 0x7AF7E145A53AF168ULL,
+            0x5140968A83F5DE8AULL, 0x89E545D07F3AD7B7ULL, 0xC85B63AC1437AFD8ULL, 0xDCB7D4F6D9013687ULL,
+            0x9DF7F995B87A752AULL, 0xEA0F4262D5B28B40ULL, 0x3F8DC543517F3E56ULL, 0x4E4F3B83448C95AAULL,
+            0xF304CA9FBF97A601ULL, 0x4CACB095C3DB290DULL, 0x32F5839183897C1FULL, 0xFA8C66227F1C8927ULL,
+            0x0580625A5E0E19F5ULL, 0x7649EBDD1B06D886ULL, 0x13FD5B00D2F834B7ULL, 0x4E56AC5179FA091EULL,
+            0xEE3AF33811B07A8CULL, 0x24E54F54702E3979ULL, 0x31B3F60D22F91B4BULL, 0x2201FDD012E95BBDULL,
+            0x0D64CFA9AF79C64AULL, 0x26DCEC8DD413E746ULL,
+        },
+        {
+            0x237CA3F615BAD108ULL, 0x7D6BFF8A0050E6AAULL, 0x1761B3864772ADE7ULL, 0x926EDC496013D17CULL,
+            0x362327BBDFB429DEULL, 0xBB9A74802C20F60DULL, 0x3F2C10EF13C694A1ULL, 0x9EAE4CD2CD4011C8ULL,
+            0xAD3A089FFD31E3EBULL, 0xA45EC14B87161AECULL, 0xC11B734C0D710DD9ULL, 0x8023C6209B97B982ULL,
+            0xCCE78A05A49CB671ULL, 0xDC0A4C87788C335DULL, 0xB91230E56BEC5C7BULL, 0xFFB723E425A5FA03ULL,
+            0x7BC047BE99BE5137ULL, 0x849179DF41958055ULL, 0x2361903616561E15ULL, 0x29F7C42602ED9769ULL,
+            0x14376CB22B6EB607ULL, 0x2F4AEF2657030AABULL, 0x81500DF836C6C67EULL, 0x2B838A9C87311472ULL,
+            0x2EF91BA605402ADAULL, 0x8CE6F88EA4055C0FULL, 0xD7FCE5617975B577ULL, 0x9C70CB5297FEE3DDULL,
+            0xDD2C8EBA83A6495AULL, 0x1E858543F0881348ULL, 0xEE390EADF5D8D16EULL, 0x1C9EED2334B2FB4CULL,
+            0x3DFCFCBB9A78CDBAULL, 0x12F98D7B4F8A12A1ULL, 0xB1967AC8044D8EC4ULL, 0xB75889497F4C24D9ULL,
+            0x2CE631ACEF80AAD0ULL, 0xFD0E8D5A7C251F85ULL, 0x3E4A4D8F4B9E14FAULL, 0xD07EB393DCB55653ULL,
+            0xA52A28B2ECEDC83FULL, 0xFA761B46F39FFC6FULL, 0xC81234AB16A43857ULL, 0x3E3C85C8654385E7ULL,
+            0xAB3D29DBE38C9B2CULL, 0xBC181110B63CC91AULL, 0x58F7715BED51B608ULL, 0xDE61C4A716EF9764ULL,
+            0x7F54EFA0335F114AULL, 0xB35525B13D04BDE8ULL,
+        },
+    },
+    {
+        {
+            0x9FE7D7CC14CACE93ULL, 0xB62BA6FAD81E9FCEULL, 0xEB74E7E3DB129171ULL, 0x6C1699E51A08C813ULL,
+            0x63F6F8C8318ABD43ULL, 0xFF9F08D9A51C98F9ULL, 0x76BCB0DDBD7FBF88ULL, 0x739F154BEBF5A2F7ULL,
+            0x99DE6ECD1DF01472ULL, 0xD17C3068A8F4A8DAULL, 0xD9A66414BF82370BULL, 0x6108DB2013DB91A5ULL,
+            0x7B4BAEB008A0EFC6ULL, 0x27762E1E62409F99ULL, 0xF05533336C9CD8E6ULL, 0x26A454C387C118D7ULL,
+            0x1583FB574DDE4F26ULL, 0xEBAE7AACA942FA38ULL, 0x1405E7881C71F1CCULL, 0xB23951D7EC52E12FULL,
+            0xCF39BD2AD54DEF2DULL, 0x45F502BE511F1FB3ULL, 0xFE709E15D314AD4CULL, 0x6C16105F061C5716ULL,
+            0x39BAA0B361976A38ULL, 0x47468A8B1A11CAECULL, 0x1B0EA40F15F8D279ULL, 0x7E6A876C54929D9DULL,
+            0x2911F5BB04E37FE6ULL, 0xA793939E24FB8099ULL, 0xFB153B2DB5F171D8ULL, 0x85D91573768BE53BULL,
+            0x8C930924F65ADC31ULL, 0x1DEC1DCEF91545C9ULL, 0x4DBA7B77F30B3D02ULL, 0x5AE85F18EE722BF8ULL,
+            0xF90F58E5650531AFULL, 0xB56D42C028AEB00CULL, 0x47BB87FE898A6E6CULL, 0x8BEE69FC98AF61B0ULL,
+            0xF46515FC00965373ULL, 0x17FD0E1E9147C315ULL, 0xF44EAA60565129D3ULL, 0x6A96EAF0190D9F40ULL,
+            0x46A36B62A14C547EULL, 0x69F3DA1D9B381356ULL, 0x01C5D168818076F0ULL, 0x9B2B6C5BAA7ACA1DULL,
+            0x4500EC98EB4D18C9ULL, 0xF407839B8BB490B8ULL,
+        },
+        {
+            0x326D9C296CA2D799ULL, 0x4157F8A4E4D15476ULL, 0x7AD28570E57F2B5EULL, 0xEBF11CC53B04C288ULL,
+            0x185CB8F43A09690DULL, 0xF9C841C74C38989FULL, 0x6232F63A83492E6EULL, 0xA6B24E8CCEADE7B2ULL,
+            0xCF529189E14510FDULL, 0x49AD69420AE4059CULL, 0xA1D14CC8E26D2A97ULL, 0x09105B4727B5B502ULL,
+            0x9FE1AAA14FE7DEE8ULL, 0x7B56F6FE59F8AB55ULL, 0xFBB7B3AC908D2F43ULL, 0x46253BE144B585DDULL,
+            0xA239969D68CA3996ULL, 0x4E2DA0BD376D0865ULL, 0x1F761CC6E1276B35ULL, 0xE7908DD1591F48A3ULL,
+            0x10B85969288F3EF2ULL, 0xB6A22B1F86D1DC0FULL, 0x42C234270EC49C77ULL, 0xB4E69CB5B36EE88FULL,
+            0xF2A577CA339FF69EULL, 0x4F51F477E330AEF3ULL, 0x1D3F1C07F3DF136EULL, 0xC4334E9B8401B6C8ULL,
+            0x5074F51D8AF707A5ULL, 0x1ADD3364AD03A0EAULL, 0x36DA64D0EAFADD2BULL, 0x884DA506AA9F0251ULL,
+            0x69FF6A34F06A8815ULL, 0x8A13238422A0F845ULL, 0x2E805B398C3908F5ULL, 0x6D7B04901F35E7A4ULL,
+            0xA70248758450E56BULL, 0x2DCC2E969B0E7E61ULL, 0x2957B4DB0FD1DADDULL, 0x4765A14DAAB36E28ULL,
+            0xEACD6DC2F51082F4ULL, 0xF5F7900F19669EF1ULL, 0x3872859E1235CF8CULL, 0xE2BEF07094B5C713ULL,
+            0x3A8E433DF0B5085DULL, 0xAEAE20EAAD07D50DULL, 0x4D2795B2B0C739E7ULL, 0x7EB4E6855FFC2E54ULL,
+            0xE860DAE5A992C308ULL, 0xDCCAAB28170C248EULL,
+        },
+        {
+            0x6588F7EFBE34DF47ULL, 0xAFD1050679E58739ULL, 0xDD32508FF87EA277ULL, 0x47B3B00F698E22F3ULL,
+            0x42D898931467E276ULL, 0x8EBEC019379D7032ULL, 0x6C5E0477400C0652ULL, 0x36D51721B8FBCADEULL,
+            0x11E43A3829B54ACBULL, 0x656F42AB78D1F29EULL, 0x3FF411F449F936FBULL, 0xA744FE0ACD541A56ULL,
+            0x612AB1EAC146E7E2ULL, 0xBB5AF5123CDBD2ADULL, 0x63EBEBEA88936E48ULL, 0x31B1BEACA1B8DA94ULL,
+            0xC3F5F9F191DD8E21ULL, 0xC48934EE8EA39D7DULL, 0x7A31DD1CC2F82507ULL, 0x8283E261A8CE748DULL,
+            0x6E9F65F040DB6B24ULL, 0xDD44D8F9D20094F2ULL, 0xEC2E334361A9E95BULL, 0x8D83B3BFA8A98C49ULL,
+            0xA64C36021630ED11ULL, 0xF8966B265293E88BULL, 0xBDF4CB8DDCE98D9AULL, 0xD12DE3F03C827801ULL,
+            0xEAD825620A075CB1ULL, 0xF67DC44E18C25E48ULL, 0x90D810026E4548F4ULL, 0x491F48DBAC1F7F65ULL,
+            0xCB01D3CA82C238DBULL, 0x15B1B2303486EA6AULL, 0x94230BF9D2643D3EULL, 0xE71AF706CAE07AC4ULL,
+            0x0C853A6166518B31ULL, 0xA39287B58957C467ULL, 0x0F6660836B66922FULL, 0x01182D560FC734CBULL,
+            0x1654E06E6448E862ULL, 0xB630F1D2F5D22132ULL, 0xDD367B19737789F0ULL, 0xEDCB2547588B1AE3ULL,
+            0x9BE4268B3F8CD416ULL, 0x48FB8B704038083EULL, 0x6905F70AC0E1B7AEULL, 0x1ADAD1B8657A5F41ULL,
+            0x4D360733B7B15BBFULL, 0x2E87FED87A6F36C8ULL,
+        },
+    },
+    {
+        {
+            0x4013276802C55AA5ULL, 0x924A4AFB7A62D950ULL, 0xC55B91E8DECE48E2ULL, 0x3842ACDE2C1BACF3ULL,
+            0xDA1D1DE26DE2C76AULL, 0x5CAF0035B9AD9864ULL, 0x750CF106BE1C5A54ULL, 0x17EB00F050FC77E0ULL,
+            0xB6EEE382EFA2770FULL, 0x6C5F1B086C431021ULL, 0x5B7A761A72D9BE41ULL, 0x81F1C506BD61BD7DULL,
+            0xD93C0F38DD558147ULL, 0x1D1C31F47EAD9B85ULL, 0x6CAFE7D08DA281F2ULL, 0x2A6575C7E4C5F871ULL,
+            0xE14FF8B57AFE4FC1ULL, 0xD4EF2985A05C631EULL, 0x74D6427A88D7DC58ULL, 0xFF6D4632787A65E0ULL,
+            0xE95AC2709CF9E92BULL, 0x40EE05721EED3039ULL, 0x0D0509156FA9C419ULL, 0x7A2CC4A0F426B1D1ULL,
+            0xB45D7F213BBCA8F2ULL, 0x4E422D1959B9AD23ULL, 0x83B2A5A9DDB7F6B9ULL, 0xF4EFAB6F330E1714ULL,
+            0x92A8918A707B4E3AULL, 0x59ECCB24FFC37626ULL, 0x49E3143E5AB1B94AULL, 0x069F6C512C33C8B8ULL,
+            0x2C4A9459F9DC8129ULL, 0x2E55726009FC526BULL, 0x026B38D59CA8500FULL, 0xB517475FD15AE36FULL,
+            0xD55B8C54BEFF6D69ULL, 0xD6E032559612E9F3ULL, 0x7A261CE3457AD0E0ULL, 0xB9800E14BDDA1D41ULL,
+            0x800B5F8113F8D93BULL, 0xFC276299F85C0649ULL, 0x7A060DE1446E0C05ULL, 0x1881E8ECBE5F715DULL,
+            0xAA657A716F2A38FFULL, 0x075701F066F9B34EULL, 0x58CDC357A96153A8ULL, 0x11489033820C7B0FULL,
+            0xF82DAF5C69054039ULL, 0x112DDF38F17264F9ULL,
+        },
+        {
+            0x02B675B9AC769E70ULL, 0x48F76038CFDFEF4CULL, 0x97D8F194B3760392ULL, 0xEE92BCF111C84B15ULL,
+            0xB79596C2F51DBEC3ULL, 0xA2A453712ABC557EULL, 0xED0E386D89FBB254ULL, 0x36D73ADCFA2E5030ULL,
+            0xA98BB84203680090ULL, 0x20804526B45EF491ULL, 0x9D60BAB8AA694D38ULL, 0x0A771139CB8DD1A2ULL,
+            0xF9B14AAD2458E281ULL, 0x9EB1CF0BD270D304ULL, 0x8E40932FA4C473A2ULL, 0xC7EDA4B2E36F53C5ULL,
+            0x6DC061250F41DC22ULL, 0x73BE54148098171AULL, 0xC351A770CE17A1B4ULL, 0x75CE7D6599BB63F7ULL,
+            0xAC8AAB9241CE08F0ULL, 0xDCD2BDCF8613A8E1ULL, 0xBD524A44C70997F0ULL, 0x3BF39B384FA278DFULL,
+            0x3FD68A984F64EBEEULL, 0xFFBCFF0808CF19B9ULL, 0xEB46D5B25BBBC9CAULL, 0xCE622E77B1758CD9ULL,
+            0x8968E43751EF7180ULL, 0x30E887573466CF63ULL, 0xEA72D1BB2E2BBA3DULL, 0xCF0874AB21CCC209ULL,
+            0x9579134E6F64F9CDULL, 0x484194647341E37EULL, 0x7A482F58A9C07F38ULL, 0x8774B2C204E731C6ULL,
+            0x467A158EC3504E25ULL, 0xB03C5C7C8CF3C7F9ULL, 0x6F36C9B0CD88FE36ULL, 0x142F7274957EA24AULL,
+            0xBDA0CC71ECA98D8EULL, 0xFD688543EE887D15ULL, 0x1EDCF0B2D5B688AFULL, 0xFF6B260450562E7EULL,
+            0x6C31EA3333F6DDA2ULL, 0x977F847142A01899ULL, 0xF9C4591DB6E05EE8ULL, 0x323E5C9076ED2455ULL,
+            0xED8D996FDF794B5DULL, 0x1A96CDB86AE8CE8BULL,
+        },
+        {
+            0xC46EF0DB0273DDD6ULL, 0xED29DDC14CE08FEDULL, 0x785718FBCCC315B2ULL, 0x793C23F2171BBF19ULL,
+            0x371E61A19E776E27ULL, 0xF74B5C627F22E93BULL, 0xA6BCC1222A138229ULL, 0x543480AC84380F6DULL,
+            0x61BEF7B7DAB80433ULL, 0x87C4ABED2A7C18FBULL, 0xEBE3A4DC9025BE0AULL, 0x132DE9E3F84737F6ULL,
+            0xC4C024CFC0B68419ULL, 0x1F182B4B3CB7CF51ULL, 0x46CD53EAD7C9548FULL, 0x3F6ADC45D16E05E6ULL,
+            0x21622146012B606DULL, 0x8CC32358B0268DEDULL, 0x2314D786EE341BB6ULL, 0x3C3E1964519A5E01ULL,
+            0x920FDEAC2194CAFDULL, 0xB55EE55E7DEAFC28ULL, 0xE84B08E0A38B23D0ULL, 0xED147A556750C197ULL,
+            0xB4BE682BCA34E5D4ULL, 0xB7D77F097E1D791FULL, 0x2050B5528CC6E42DULL, 0x149098C441A9C2A5ULL,
+            0x062636CDABCE9860ULL, 0x38185CD52A931D50ULL, 0xCB0D7322997F6F6AULL, 0x81392EBB78130B34ULL,
+            0x9FD34BB4AB036022ULL, 0xDD9A487B324D2E62ULL, 0x9D61E1322BD26CBEULL, 0xF604C612B94727E7ULL,
+            0x562B4E1949D0B068ULL, 0x504D85290F720B08ULL, 0x0A34F4909AB32D1EULL, 0xC19D4FD4EB66CCC4ULL,
+            0x528D982A2221B05DULL, 0x7BE65DD240F8447DULL, 0xEAF10828C58D0BB5ULL, 0x3B1354DCEFF65CE2ULL,
+            0xE04B18F5F194C8DBULL, 0x9946C137894AB78AULL, 0xA11F3477E2CE8065ULL, 0x906236F126EDA425ULL,
+            0x0300FC936717D62DULL, 0x76094882DB6BD2C1ULL,
+        },
+    },
+    {
+        {
+            0x1C37DD2B54399524ULL, 0xC3DBEE63604C2F0EULL, 0xE5B7CDA359C6B4D0ULL, 0x5F96D152A3300DB9ULL,
+            0x7CCA6BBA8C0623E2ULL, 0xB142399B12A09725ULL, 0x856C85F1E0D2BF4BULL, 0x2CC9DC3331BFA8F5ULL,
+            0x5D80BF2058E04AE4ULL, 0xB0582F6B4FFDB371ULL, 0xECED8CD8B8CEB457ULL, 0xB021AFC75566DCFFULL,
+            0x6B104428C4E8CE86ULL, 0x8F4B1B084BB47E9BULL, 0x6146358598A3D0A6ULL, 0x7180E9783C7C7E87ULL,
+            0x0E2208BDD3BFC7BAULL, 0xFCF4A793927416B5ULL, 0xD83B8D714D33F3D8ULL, 0xB7FBB5C25950623FULL,
+            0x32EA726EDFCBAD3BULL, 0xB1D7ECB4AC7A14A1ULL, 0xBB4AC9AE48A3E8C8ULL, 0x1ECD7D187BE39D19ULL,
+            0xED0D2E20B8963C63ULL, 0x1ED89C88CA5268DBULL, 0x20C1124637D39ACAULL, 0x8CA6BF12A2FDCF7FULL,
+            0x9EC560D397660B21ULL, 0x6A8CFD4776402F77ULL, 0x439E813B489B92E9ULL, 0xA56E4E9E15AB3F8CULL,
+            0x8202BE4F31580AF3ULL, 0x49C93E18342A6626ULL, 0x370EA8D2B4CB7B6AULL, 0x4CBE4F95A229771CULL,
+            0x40083981E83762F2ULL, 0xAEAA604DEB0FF0B7ULL, 0xD64A00F0081F2296ULL, 0xC498BEDAF9337953ULL,
+            0x1E9BB85539F72B61ULL, 0x13E82B1171CC3D77ULL, 0x34E25E3E961418CDULL, 0xF0101DAAAA5FA3BCULL,
+            0xF6A33B587B6273FBULL, 0xD8531EB20ECF29DCULL, 0x11582D93BD3D408FULL, 0x09C3748D8E9AF9CEULL,
+            0xA634B8D4937A7FBDULL, 0xDC9120872330C402ULL,
+        },
+        {
+            0x77A134E733D3E50AULL, 0x03EF42E0F56C4040ULL, 0x9F8FF5C8F61E88C0ULL, 0x6C4EE44C3AEA85D1ULL,
+            0x6A087CDF41B0049AULL, 0x02D9948297870213ULL, 0x9BD473AB4284E8D7ULL, 0xA612098E41AD34C6ULL,
+            0xEA9CA7CFAEA59F2FULL, 0x4FE7CE4AD4D8FFD1ULL, 0x24B218915C689A6EULL, 0x819B9C0C560F10DAULL,
+            0xB63E7C18DF8A787BULL, 0x43029A6E6732124BULL, 0x8025A2463C6F84AFULL, 0x4A0509C77BAF9066ULL,
+            0xD014441FC13C16C6ULL, 0x7EA6F5860DB51F6BULL, 0x91E78651502ECF95ULL, 0x8FF7B6938E5BD74AULL,
+            0x607B0661A193F264ULL, 0xB8D8ACF6E160CC80ULL, 0x546A663917332D19ULL, 0x243186BC96732D03ULL,
+            0xA47BF433C106EB99ULL, 0x355E03917A51200EULL, 0x1DC3A55A6B7041CEULL, 0x1A722EFA2E1512CDULL,
+            0x3CCFCB46AA042BA8ULL, 0x64581665B0D1C9FFULL, 0x742764C49DA5F5ACULL, 0x88B30E3269D85547ULL,
+            0xBBB94AE3D9EC542DULL, 0x64BB2423A04527C5ULL, 0x5D298BE2AB20FCCAULL, 0x86FA069A26B6CFB3ULL,
+            0xE635DDB43B662EECULL, 0xE5E2C2E0FC24D9B1ULL, 0xFD78FF671758DC42ULL, 0x883F1C256E3D3D7AULL,
+            0xE66EDE83BF015980ULL, 0x95A77203257F3B33ULL, 0xCA13EFBB48976985ULL, 0x29C2A27DFAC08616ULL,
+            0x734944B324E2429AULL, 0x67B6FABFF356609FULL, 0x3429ECAA82070B9EULL, 0x8288AAF7F3A02209ULL,
+            0x66AC18377014C00DULL, 0xA3D2A453165F4ACDULL,
+        },
+        {
+            0x189DEAE400C8E718ULL, 0x74DB240F87BFB0D6ULL, 0xD2D963DDF5283A37ULL, 0xCEDB9FD60C8C0783ULL,
+            0x85AD1A323DFC9F4CULL, 0x30CBE1A4DFAD3572ULL, 0x452D33473CC17398ULL, 0x5C6E06588269177FULL,
+            0x25EF4BB67EE5FA91ULL, 0xA3C49F0B7E7CB524ULL, 0x460F79366B95854EULL, 0x6623423829023DC4ULL,
+            0x11543359CF19C8BFULL, 0x7F4E736BEA3E34EEULL, 0x2021A1C512F4B307ULL, 0x770856A644DF7BA1ULL,
+            0x332486F9CAD00D16ULL, 0x33055114DDFC288CULL, 0x92699986E9E673DDULL, 0x4C7D51968326E87AULL,
+            0xDA606BDA4CC1FB2AULL, 0xFEB8FA8113FBF25CULL, 0xF2B42B99B41B12B8ULL, 0x516954E1F6DA8A9DULL,
+            0x7ADF2562A35638C8ULL, 0xB09B7EE539F5A6B9ULL, 0x72292219BD50C3B4ULL, 0xD5F74540DC0A0F33ULL,
+            0xFDDDDDD3710DB7EDULL, 0xBFC1386ACDFBF7C2ULL, 0x6BD1C9DD793FB0ADULL, 0x3621465FF32C448CULL,
+            0xC44373DF7140BF05ULL, 0x72F5FC16361B5F3BULL, 0x65AC3A2F79CDC745ULL, 0xEE55DFF2B7B12D8BULL,
+            0xE92DE85E01044D10ULL, 0x9CD28F4076A3018AULL, 0x258E89E9F4AD6509ULL, 0x557F916A1BBA5D83ULL,
+            0x496EA2ED395A29F8ULL, 0x5B9282F637CBE3ABULL, 0xB2D576D4A871FEACULL, 0xE40DB90B4E293651ULL,
+            0x4155610A54C8D07DULL, 0x6B2613719560FE9DULL, 0xCB26D2D241E63820ULL, 0xD6E8D404A34FFC50ULL,
+            0xEC2B9C15692C77A8ULL, 0x58336F7F0C98C547ULL,
+        },
+    },
+    {
+        {
+            0x5A54AFC14602450DULL, 0x722DC7724930A2C7ULL, 0xD9C7E2EDD1569242ULL, 0xFD3C764752D4EFE6ULL,
+            0x99589C490BC47FB9ULL, 0xB753D03D95373906ULL, 0x587243B9E91BD6F4ULL, 0xF8EA39A21E50DC59ULL,
+            0x33986D3C42924BA1ULL, 0x0B0A3547991DA776ULL, 0x4AE848B9E6D881B8ULL, 0x566CEC8E8E745EBBULL,
+            0x441FCC6A742478C6ULL, 0xF33FEA7EA5A4C1B7ULL, 0xB3038D65A20105F4ULL, 0x0D85F4223C44FAFFULL,
+            0xD3FC5C77AFC92CCAULL, 0xC17962540F62CC13ULL, 0xE417C8E5FCDB6D4BULL, 0xDE11B931BEF2E951ULL,
+            0x2B0199CCCD9978C3ULL, 0xF8F64AF728A01AF2ULL, 0xCCB225EFA127A647ULL, 0x15CE48E1F2D298CBULL,
+            0x79C67F4608FC6F3AULL, 0x71088F0704D91964ULL, 0x1EAF8037FB167256ULL, 0xB42313C789520B32ULL,
+            0x7DA7726054EC23A4ULL, 0xCED4F87F0EFF92E3ULL, 0x0E5FD526D756B506ULL, 0x06B5CA38AA2D99ECULL,
+            0xCB0AFC87909C39DFULL, 0xE0A145981350966CULL, 0x0F79A841BD1E2C40ULL, 0xC3BE0413BC570018ULL,
+            0x15C6D6A73EDCA818ULL, 0xE4B0B00E7C181748ULL, 0xC9B0D56B8EC0F566ULL, 0xED4E71632D54ED0CULL,
+            0x82E497C92C3887D6ULL, 0x0268C85D2609C359ULL, 0x4FDFE6F96B60269FULL, 0x266240DB0748A112ULL,
+            0xCA413CEA1EEC34D0ULL, 0x639429444634D8B9ULL, 0x56F269F2A609BF48ULL, 0x516848CF0AAF7E36ULL,
+            0xCD52EB8F0A376D4AULL, 0x08BBA47E56711110ULL,
+        },
+        {
+            0x70162F1A7ADFB732ULL, 0xA19C94C2069984DCULL, 0x8810F56515C400D5ULL, 0xC975729815DD1D94ULL,
+            0x1E6FDEC5745D42AFULL, 0xD9209DCF2664B3EAULL, 0x5CEF25023763C00DULL, 0x436CDAD0DA66A4CDULL,
+            0x81B8C1DAC36AFAC4ULL, 0xA5B97890CF681E31ULL, 0xE4C059D1F3AD624DULL, 0xC8F3BDDD00C90BC9ULL,
+            0xA5C9DE193ECF4B9EULL, 0x47504014B301F289ULL, 0xA87CBB4C8212732CULL, 0x3DDAA286E87B1CCAULL,
+            0xBFB45A9DA8139873ULL, 0x740FE91763ADC383ULL, 0x36EF63BC2FE218C4ULL, 0x74340FCA37C96DF5ULL,
+            0x53642B27389F226EULL, 0x4CF5A77A3A3F47AAULL, 0x521187228E2593A5ULL, 0x18A7DD18D3AD91C2ULL,
+            0x7F05B84E4F94FA61ULL, 0x1B233BAD7ED36BD5ULL, 0x0E11C242CD0A9842ULL, 0x679D9AA9E2DADDF2ULL,
+            0xBA1F8F93F58454C9ULL, 0x1EF85907A5A34E20ULL, 0x2C224B17AA8780BCULL, 0x1BFD9771955F20BDULL,
+            0xAD6209C5E6D211BCULL, 0xED69372D2E925A9FULL, 0xDDAEBDCEE8DE39EAULL, 0x962A456DFB8EBF19ULL,
+            0x34EADD829C7B4427ULL, 0x19A7E53D59C85B6FULL, 0x79FAFA99BA32F019ULL, 0x1A6C29B73C8BB3B9ULL,
+            0x69107768D3556A9EULL, 0x4882622D356CA7CBULL, 0x92DD0AA4785EEC44ULL, 0x1EA7639F7BA5C09CULL,
+            0xB8D50D904C0B2C1DULL, 0x8D67DDAE31D19D05ULL, 0x0979EB48948BDF7FULL, 0x842C615FB2B8F701ULL,
+            0x385AE226705E66AFULL, 0x443DDF90C4B691A2ULL,
+        },
+        {
+            0x4F206DD7B2ADD401ULL, 0x1F75B6CE53EFAFE9ULL, 0xE06AA6F794B2AAF6ULL, 0xCC4F38166629B223ULL,
+            0xF56E82A0E5C30987ULL, 0xF33980D0A9520E54ULL, 0x6707E84263D9BF48ULL, 0xEDD9F6409AF4DE36ULL,
+            0x5F1FBCB4C9247A0AULL, 0xC66EFA088615F07EULL, 0x7322EDCBA456041EULL, 0x7221624B39306F96ULL,
+            0xF41B0831BB392AC9ULL, 0x9E676391A6E4CADCULL, 0x89363663CD523449ULL, 0x39C98ACF5C0EA261ULL,
+            0x8B996B281B980765ULL, 0x86A6CA0F31144E2BULL, 0x9BB32534FB4E8C77ULL, 0xDCB8B00249CBECAFULL,
+            0xDABF0CA4235AB0B6ULL, 0x84E008933B08E857ULL, 0x92A20FB1DAC00C47ULL, 0xEBF28D7CF3C07D9FULL,
+            0xE96C423400C37AA4ULL, 0x4EB8F9399DEAD551ULL, 0xBB1F688D27B874BBULL, 0xF5676B1848594A92ULL,
+            0xCD9AE5457EC71C87ULL, 0xCC0162D20091537EULL, 0xC890C1D3761B6E58ULL, 0x25978D81A6EFCE84ULL,
+            0x39D2392C87B33019ULL, 0xF318EE6FB4017039ULL, 0x8AB438BAFC005C99ULL, 0x4E51250C36BC5A60ULL,
+            0xEF1D578B7F23BAD4ULL, 0x85584CCC472BC8A1ULL, 0x029A9F2642A39770ULL, 0x06650386CC910C5EULL,
+            0x44187821374CF9C6ULL, 0x8760143C9A4ED1B5ULL, 0x141B1D8AA8548156ULL, 0x4F676C0C43A6BDD4ULL,
+            0xF0C3E3D86E6A05AFULL, 0xB23396CDB04A5A64ULL, 0x28611164DD50D7D0ULL, 0x29EFA5905EDB827FULL,
+            0xF6C864852DBF4ABBULL, 0x1ACD327354BDFAEEULL,
+        },
+    },
+    {
+        {
+            0x01501A3AD701FA9BULL, 0xDEA5D55F22DE3FAEULL, 0x3E0BF4A5BC43A851ULL, 0xBB49581DA4591B41ULL,
+            0x63F52D3118515937ULL, 0x97912205E99B5645ULL, 0xCAA7E0A24D0751A9ULL, 0xAA7F8AA888E8154AULL,
+            0xC6990C294E95D7E0ULL, 0xDDB21AB20B1F044FULL, 0xB91503E5DB4FC987ULL, 0xCEA11F8A9593D7D4ULL,
+            0x37CFD0CD9441857BULL, 0x514F91CF5EC538B1ULL, 0x8FF73AA2AB20BE80ULL, 0x3A404A0B8E735FFDULL,
+            0x4003E53DA243E602ULL, 0x0F7373AA77A2A14EULL, 0x038D0EBC70D4778CULL, 0xC8515214CB1FBC63ULL,
+            0x3A144934255CFBDBULL, 0xE25DA2A32C8BD4ECULL, 0xFFDDB1C8C2307845ULL, 0x88CCC1988348A9F5ULL,
+            0x4C7AC4E7BE96E5E6ULL, 0xEA69EE8FEBB471ADULL, 0x11AA4D4B3356D20EULL, 0x025C78FDD2913C2AULL,
+            0x060C10D6035A54D2ULL, 0x7F269BBB1AA594FBULL, 0x1B35B5CB754E8112ULL, 0x297F029851061890ULL,
+            0x69ED96C9827230A1ULL, 0x4517581772EEDC80ULL, 0x9505E57E7E5E2139ULL, 0xD438DCFB377BF33BULL,
+            0x24F8367D35B4AA1DULL, 0xDDA79087FFA4E409ULL, 0x2CB30A6A9AE18F81ULL, 0x066C290BDFFB8CDEULL,
+            0x12E946285FB28C47ULL, 0x10D371098318189FULL, 0x35DF0FFF8BD7EF6EULL, 0xAB7846D4CAB65B30ULL,
+            0x969F919AF2DFFB86ULL, 0x48D88936445665F1ULL, 0x23325ECCDB0D957AULL, 0x4C7674C512D190D0ULL,
+            0x958F3626116807F1ULL, 0xB46B6C8910C90BBEULL,
+        },
+        {
+            0xAC5399B67D8FB629ULL, 0xE78C941382560305ULL, 0x86C718F46C34CE43ULL, 0x29A20676BE29571FULL,
+            0x799FEFD6B7012271ULL, 0x63E40F97C6839C75ULL, 0x5680AE67767D260DULL, 0xF399DE1A7D1BFF01ULL,
+            0x80FEC566218028BFULL, 0x124BB4E94682E72EULL, 0x061DE1A6BA93E960ULL, 0x726F38F8035496B2ULL,
+            0x259DB1A0129FD31FULL, 0x53A6FECF99DFCB79ULL, 0x6AB8E30C9D2F8AAFULL, 0xF2A4BF0D02569E7AULL,
+            0x4F7D290C85B6EDC6ULL, 0xEA1A59B54F84319DULL, 0xF3242DECBF58FEBEULL, 0x6493D6EFEE4820C3ULL,
+            0x7093F8796700E042ULL, 0xD5E37ECD2BFAB102ULL, 0xE7449C4790E144E0ULL, 0x992BE89C73DFBE69ULL,
+            0xC9A4801F3DB0BB55ULL, 0x0BD8D8792649AF63ULL, 0xB664B44C7A7884FDULL, 0xE2463910B95AEAB4ULL,
+            0xE9E1C1EF77067261ULL, 0xFEDCDB202BB2C6C5ULL, 0x3AA610F3BB9CB208ULL, 0xD7D74C433F5E096CULL,
+            0x15DCCAE173736E7EULL, 0x4715E445AEC5D722ULL, 0x2C16372D8611D40CULL, 0x2AE6A7328AA174A4ULL,
+            0x10E8257157E79F4DULL, 0x134BFD1EF9202333ULL, 0x88CCE30717D6CFB5ULL, 0xA77932866B682F6AULL,
+            0xD802DCA4733065B4ULL, 0x7E5E88942B87E87FULL, 0x85ECABB52FFB186FULL, 0x64168A88F351159FULL,
+            0x83BB334974A93074ULL, 0x97D66DE2142AFF14ULL, 0xACADF1865A8BEFEAULL, 0x13FD12D20C5242B5ULL,
+            0x8B39F4E7226CEB70ULL, 0x01D98E723730EEA6ULL,
+        },
+        {
+            0xFE7DE266CF47E6FBULL, 0xF14706064013B7F6ULL, 0x9294BC9964B2AD19ULL, 0x3B53C1C87375AE03ULL,
+            0x779F0C48C006A59FULL, 0xE7FB3158DAB42F14ULL, 0x94670D8A477C024AULL, 0xA6E3F0995D2728CEULL,
+            0xAC56BC16E970951FULL, 0xE8D6DDB32DCED3F5ULL, 0xC1F3BDC4C47B1312ULL, 0xD125D1ABF23D61B4ULL,
+            0x76A183DC6A59F677ULL, 0x33434EF60A88385BULL, 0x33583388FE4E5EEBULL, 0xC97011E986D41896ULL,
+            0xBC397CEBC9835527ULL, 0x09236513E0FBFA4DULL, 0x53371624FB7F3EF9ULL, 0x6C237B6B37115EC4ULL,
+            0x002C9C5294024D79ULL, 0x941F7363175037A3ULL, 0x95D3F0A43D9F1F0CULL, 0x19E31A7D35A66232ULL,
+            0xB1393197AEFFE276ULL, 0x31A457E842704032ULL, 0x601DE0DCDE86EC32ULL, 0x324A41F741D2AD6AULL,
+            0xFBBD5C30AB3712B0ULL, 0x2F12F42344D9D095ULL, 0x1277ADECC2DEE674ULL, 0xA5BD4184FD5C46B8ULL,
+            0x86B093538B0A5035ULL, 0x3A1E1EEB7724E9D5ULL, 0x15EF1D7B1F467546ULL, 0x0B7112F42615682CULL,
+            0xBB48051775FEC9FCULL, 0xC662C54E6B46CB6FULL, 0xA39B60A8053D7D39ULL, 0x378E175166C96983ULL,
+            0x13704522AC4EFB90ULL, 0x6AF7F33F21148267ULL, 0xFBDE23462F7CD2A3ULL, 0x290047E121CEE3C6ULL,
+            0x17810385D34F4F81ULL, 0x82A19F0BC076115EULL, 0x7DB47679DDA16AFCULL, 0x84316D68454D1729ULL,
+            0x12DB95C4AAE96747ULL, 0xED92AC83BD9F8449ULL,
+        },
+    },
+    {
+        {
+            0x047E859F3F8E8901ULL, 0x24309E4DDBD5F453ULL, 0x996CC0575D632B7BULL, 0xCE3D7B5469A653EDULL,
+            0xD28D9CB4EA88440AULL, 0x0E15647C05C91602ULL, 0x01C68B82241B44AEULL, 0x94293EB07D5999A7ULL,
+            0x2C6A3E9A3E59A354ULL, 0x7C295BED22034512ULL, 0xFB5E763A9E044718ULL, 0x1A91D224F1E68996ULL,
+            0xED94C7ABD29FE105ULL, 0x888CC347A1EC3F87ULL, 0xEEEC5BB51E20E638ULL, 0xFE520C45B30A29F4ULL,
+            0xA00470E13E96C0A7ULL, 0xE17F6503C88324E6ULL, 0x4993B4A43D19DB2FULL, 0x45BB2D808EC2C359ULL,
+            0x740BE429063AB09FULL, 0xBA50C07588F5023EULL, 0x3809304EB197A7BAULL, 0xD15D9C64F1002675ULL,
+            0x2294580A4AD71B79ULL, 0xDE222AA49EF54B0FULL, 0x3251D3FFC7498259ULL, 0xE6BFC29994D6A71DULL,
+            0x4D17A4899C936D13ULL, 0x8C9E179318C16F09ULL, 0x1634EAF63C640F97ULL, 0x783C68FBCC7DC248ULL,
+            0x5A646EEFCB44ABCCULL, 0x1F4645AAF3B7519BULL, 0x2D8BBE85D24739F8ULL, 0x3F66ECE13C04C98BULL,
+            0x9ED1F208E3CFC2D8ULL, 0x3E8A3CEA2F19EB5DULL, 0xD61357565FC0AFCBULL, 0x62AE42CC6E05BC54ULL,
+            0xEA87A0EA8464222CULL, 0x95AA5DC50EF1E168ULL, 0x6C68D091B5ED58AAULL, 0x51569E6B97F3E89BULL,
+            0x350759265221498AULL, 0x7716AB88ECD42999ULL, 0x51DFE317C220C78AULL, 0x6E2C9BAD346E2485ULL,
+            0xE216ED644207798CULL, 0x1C18D937CC92947FULL,
+        },
+        {
+            0xBEF9F6A6480F4E97ULL, 0x4A9CB8E4C50A15CAULL, 0x9C31397D6A7E3361ULL, 0xE85D3B8EA7C43747ULL,
+            0x22E32C75D0BC8EE9ULL, 0xDD7E46885E8B6DB4ULL, 0x32031174AD85966FULL, 0xEF16F1205A70E683ULL,
+            0x0E65ABC11531C78EULL, 0xDE807542EC998781ULL, 0x20888722964D74CEULL, 0x288DD10AD5EB1DA7ULL,
+            0x36C860C65D8B425CULL, 0x2EE6BD775C1B43D8ULL, 0x74097E48DAB6835FULL, 0x90DF884585FAD999ULL,
+            0x4C02C063FFA06A6AULL, 0x51F718F93D74F03EULL, 0x6DDFF742A089D65EULL, 0x0A3BB6F819929272ULL,
+            0x855EC23708E76BD6ULL, 0x7B7977C093549081ULL, 0x9BE8CDED268639E0ULL, 0x048EF71D015F4D93ULL,
+            0xC0E887E16AACF7C8ULL, 0xD677B89B25F35C27ULL, 0x0A1C1C4BA255535FULL, 0x0D24568C965CCE39ULL,
+            0xD9652CC6324ED9E5ULL, 0x5EB1FC1BCC8C9D16ULL, 0xA0F277A148C801ACULL, 0x4BD022DDCD327AAFULL,
+            0x578E668BDE57559AULL, 0xDC9ECE600DEFDDB1ULL, 0xD1DCF128D1214E4AULL, 0x7ED3DAE95DB5DE56ULL,
+            0xDCFF5FDA9967E06AULL, 0x3EB517AF63F4752AULL, 0x6934E731600B9740ULL, 0x29758B2AD21A506EULL,
+            0x78B6668435BBBF4EULL, 0xEEE8645E93B6DBB0ULL, 0x012F41E6AC5F5A07ULL, 0x8E4A886697778573ULL,
+            0x72823811DA6456B9ULL, 0x335CD77FCABA1054ULL, 0x3809FB373B49F174ULL, 0x83ACB0BDC641BF96ULL,
+            0xE95A4AC528821969ULL, 0x755768FA0F4E671BULL,
+        },
+        {
+            0xEBFB71155E005D15ULL, 0x561397738ED7B8EFULL, 0x1E7C4B17B385CC5EULL, 0x960B0829E4961046ULL,
+            0xA74489758B1FEDE6ULL, 0xEECA58FA8D346BBDULL, 0xE203D3C820174C2AULL, 0xDD809A670C652832ULL,
+            0x09691F7F23F5AEE2ULL, 0xC73CDCFCEF7BBD3FULL, 0x5339784A74E7E585ULL, 0xD1BE1C34F35BEB0EULL,
+            0xF4AA91178F965F58ULL, 0x478C6DCFC539A5E6ULL, 0x3725BE8EFE3C6F2DULL, 0x92E24BF718587CB3ULL,
+            0xF9704E6EEEF5808AULL, 0x207294252C4F090BULL, 0xC98CF426FF46B5D9ULL, 0x209550C5684A6EF2ULL,
+            0x47F79D89B08106AFULL, 0xF8B360263DB04F62ULL, 0x0420E0B67ACCB77CULL, 0x9F662446D1DF7112ULL,
+            0x1C5AA8845362CB70ULL, 0x2483029C7FD4D2E6ULL, 0x1CA17CFA2DC502C3ULL, 0xB938543CB88A5806ULL,
+            0xCB8FEC70B2018D36ULL, 0xC5E43C84E5F803ACULL, 0xD0076DF6A31098ABULL, 0xA80DF82C7FD1F35AULL,
+            0xD955BD4A6141C63CULL, 0x7F2032EA08554AB0ULL, 0x6B814985F80B4C25ULL, 0x68E7A4307F56F3FDULL,
+            0x4C43405B16DF015AULL, 0x418B5CF6A4A9A9D8ULL, 0x6CA70E104FA78C8BULL, 0x17A9237E75EE8152ULL,
+            0xF3912506B32F48D0ULL, 0xF794A987D8032241ULL, 0x56247C459BB99445ULL, 0xF5460E6A6039562DULL,
+            0x9D31743B8FEB0FC1ULL, 0x614BAE5370F3099EULL, 0x9333D40B1BF9480DULL, 0x4C546720E92719DDULL,
+            0xF4D11EE1035480AEULL, 0x9F4E2C390039C22FULL,
+        },
+    },
+};
+
+const uint64_t zobrist_player[2] = {
+    0x6630163FF0DADA6BULL, 0x6BD7C275C8FE951FULL,
+};
+
+const uint64_t zobrist_scores[3][ZOBRIST_MAX_SCORE] = {
+    {
+        0x0187D54F5183CFF5ULL, 0x3CDBCF5AFC79952AULL, 0xA6523B76BC416C80ULL, 0xCAB04CC2F040CE59ULL,
+        0x4770BA5E8F52F985ULL, 0x6A5C6EE683AE9D36ULL, 0x999352BEEDB04D8CULL, 0xFE0EED8569E7CE17ULL,
+        0x5B88FA322B93644BULL, 0x003AAD16A7123043ULL, 0xC73D58B7C11E64E3ULL, 0x8359BCE7244D00EAULL,
+        0x1010606F998EE06BULL, 0x4CD45A69F7DE876BULL, 0x6AA050A0023780A5ULL, 0x10FB47C9F20F66E4ULL,
+        0x820460A78CBC4129ULL, 0x6E287932C34653EBULL, 0x1BFD474A3631458CULL, 0xE16C24F48EB3C407ULL,
+        0xC5A837F63741424FULL, 0x7B281A914520B30BULL, 0xF428B59F98BD50ADULL, 0x0354359E6055A14CULL,
+        0xE823CDCE4FC8D90EULL, 0xF0C744BEAC38CB3CULL, 0x7857BC702D61F5AAULL, 0x9B995D4992711CC1ULL,
+        0xAEE372CC63FAEEB8ULL, 0xD7A73BED329BB565ULL, 0x61B159FBCE217B4FULL, 0x32E4016B8A780A79ULL,
+        0x762566864A7B442DULL, 0x526D25E0837119E5ULL, 0xD8F7EDFFF8212296ULL, 0x20BED548216D0553ULL,
+        0x066D6B4E9DF6EB99ULL, 0xC951F1882018C00EULL, 0x9E4E68B24A75320EULL, 0x7080BA6622389BEAULL,
+        0xAAB90093D39D505DULL, 0xD3955EDE021FDDBDULL, 0x7FFF871698D72D46ULL, 0x534BA5AE40BD129CULL,
+        0x0574B3340E594FB9ULL, 0xBF01A558BF2D3366ULL, 0x450D213E82737080ULL, 0xA9CCBFE56179B661ULL,
+        0xD997F5D83980FD4DULL, 0x717947C7E98B0FF7ULL, 0x2A3473496D350428ULL, 0x6DB1C004DA6B6420ULL,
+        0x26E472FA5052BAE8ULL, 0x34E98082AC3BA59DULL, 0x49AF80DDF8151596ULL, 0x17869F85D0689A3DULL,
+        0x56796C911A3B6449ULL, 0x498F2DF79BDD20C1ULL, 0xD70BF244323A8AC0ULL, 0x4DC739A3FA0E4FD5ULL,
+        0xEB794F49FB87060AULL, 0x62A78238FC7CCA86ULL, 0x2ADD4B40AEC05293ULL, 0xEAF91F93B83716F6ULL,
+        0x34119EFC7AEA055BULL, 0x1CC57DE9B717E791ULL, 0xC5240179454E0C1EULL, 0x3A87740B8AC85786ULL,
+        0xC71E4329E86AE6A9ULL, 0x1ED473758F9EB924ULL, 0xFF9D1F15CEA74D56ULL, 0xEFDE130B89DB964CULL,
+        0x140D293CFE243260ULL, 0x7763F2A44C90E204ULL, 0x22A56D23B9F1C2C0ULL, 0xBE4C6D7C98209145ULL,
+        0x408CCFBC39522127ULL, 0xA4C71D1F08C62CA5ULL, 0x2C15B06F91B029BCULL, 0x7E963D806A70A6EFULL,
+        0x410BB80FDA941C62ULL, 0x99D1908F3A1E6CDAULL, 0x44D12BF7236C2683ULL, 0x4167B5E3EEEF3E0EULL,
+        0x49E895D732D8A3F2ULL, 0xF532AABC6281AE35ULL, 0x7866F3728FBB8029ULL, 0xC0C55B434E93DD69ULL,
+        0xBA92465D16728093ULL, 0x5D09968222482152ULL, 0xADDB0133FB0EA590ULL, 0xC53B93693255DCDBULL,
+        0x86AB85F38D9921A2ULL, 0x48A98E545E3C3B61ULL, 0xFEA03E5D884CBB57ULL, 0x480C367A98DA17E1ULL,
+        0x0808D08FEE8E7B8EULL, 0x2C34247C144E44F9ULL, 0x0A9ABF69BB08C630ULL, 0x93FC020A05F15BBCULL,
+    },
+    {
+        0x63F8B586EACDD60BULL, 0x85BF2557B062AF67ULL, 0x902D5C77F5B753F9ULL, 0xF0DDDE6B5BCBE31EULL,
+        0x637693B6E5577358ULL, 0x2F6629D624560BBEULL, 0x4284ED514CB98829ULL, 0xEC0F7BC053B5D179ULL,
+        0x3DDA97C60D7FC49BULL, 0x4A765ECBDDA37DD2ULL, 0x76C6E1CF522F0FA9ULL, 0x4091B8E691519BF6ULL,
+        0x975006CF31E90541ULL, 0x70C119F4BB75A70BULL, 0xB0560690E681EE85ULL, 0x548DA7BB82D7EC18ULL,
+        0xA527591A362A45C0ULL, 0x6159973E02F9614BULL, 0x0486F2D4AE1FA149ULL, 0x64DB36DCAC14EC4BULL,
+        0x4635B9E5E358B753ULL, 0xDFE0C7368DA3B2FDULL, 0xF3D7E6B82BBBEAD8ULL, 0xCB0F72929E572B0DULL,
+        0x13220C9B07F6E61BULL, 0x4F6E2FBACAADED17ULL, 0x038917C08FFB130DULL, 0xE954C0B09E97866BULL,
+        0xDC2903C80DC853A7ULL, 0xB94369127033CAC0ULL, 0x1F7DA7A81BD31D55ULL, 0xC1E80C8940D74E2FULL,
+        0x6C4CCA5B98A68B73ULL, 0x9896188B22117AA5ULL, 0xBF514C8E3D7F5110ULL, 0x838223D04397EBB2ULL,
+        0x719C2CCD2A5668E5ULL, 0xF0C4539C526C5D74ULL, 0x16864280CBED58CEULL, 0x31FEC32079CB71FFULL,
+        0x1B4BB237D46378DCULL, 0xC982CA36DE54092DULL, 0xA25AD64133314A7FULL, 0x52ED7D53FA1C572BULL,
+        0xE4952C25DA92C545ULL, 0x29216E254E20118FULL, 0x1C31117D2A51D26CULL, 0x2CDC7527ABAC6AC8ULL,
+        0x419974238282801DULL, 0x13355433719E225DULL, 0x00293508E60C2959ULL, 0x55F0DA587F77474BULL,
+        0x0A1D577FCCBB1B05ULL, 0x36D9B6BD66620C73ULL, 0x0C858D02ACF5B4ABULL, 0x9A05D78508501502ULL,
+        0x1870B5A97FB5B5A8ULL, 0x2C0EFC4E1F14B4C3ULL, 0x91C790EC4A4BCD6AULL, 0x38315E94F9614070ULL,
+        0x1FB347A09D2D9EF0ULL, 0xC2F393F1D73479CDULL, 0xD5665F3EF241C27EULL, 0x1A54CD401B6E1E7AULL,
+        0xED983191BA9C1CC6ULL, 0x4FE228221788D57FULL, 0x46FEF07C5D177B15ULL, 0xAB92870B6E5730A3ULL,
+        0xE0AD1BB3A757D602ULL, 0xF05307DE9D70B92EULL, 0x9A39535BCCF9D3DCULL, 0xAC10704FD199577BULL,
+        0xD18DBC69B4AADB15ULL, 0x711EA7C6C1D1EBE3ULL, 0xC2ABB9AAA4BCD0F4ULL, 0x153B59596C751455ULL,
+        0xD69096FAF7184B3DULL, 0x6AD4CC8FE45514EBULL, 0x866922EE8441E402ULL, 0x947470E23B24274AULL,
+        0xD58F828C49BAFD84ULL, 0x4ACD77E0B2D8697FULL, 0xE30892680452666DULL, 0xC32801DA7FCCF9E1ULL,
+        0x13EA26DDD7953852ULL, 0xA9B1A3EBA33A46A2ULL, 0x00B0AA504767DAAFULL, 0xBA22DD6D78FE5EDAULL,
+        0x3960C010FF8D54E7ULL, 0x159D3529B8A7978EULL, 0x562C13BCC680FB21ULL, 0xAD073CD425791297ULL,
+        0x4C1F6140BBC1A572ULL, 0x90DEE4368B013AB8ULL, 0x46B887212C9496CDULL, 0x611DA9958071ACA0ULL,
+        0x5AD642B44D7C67F9ULL, 0x06BE268D74EC4176ULL, 0x6DEAED76D5D30474ULL, 0x4F62E7CD52CF3F7CULL,
+    },
+    {
+        0xE5A3439A604EFE02ULL, 0xD3D29E6FDE0DA37EULL, 0x37D5360879C6A7B8ULL, 0xB2B389954585C4F7ULL,
+        0x84C94EA5939D12BEULL, 0x2218FC7D139F471BULL, 0xDC89BDA75820DF55ULL, 0xB2F72695D21BEBABULL,
+        0xF957D38FAF4856BCULL, 0xD774BB83BAF6E911ULL, 0xCA0D7F721C1D6083ULL, 0x90385C5266691A82ULL,
+        0x73F983D82BDD2837ULL, 0x4458102236887FA7ULL, 0x9A6D5042123E6698ULL, 0x80467280ADFABC55ULL,
+        0xD96940F87D5EFC6DULL, 0xB70EA8E0F03CFAD5ULL, 0x45C3D0FB8D789660ULL, 0x0F8F7501C813FF4CULL,
+        0xC5DA73B0A7F18BB2ULL, 0xF5BB28D583E0C425ULL, 0x26B14B3D9188ACEDULL, 0xA6346EC4D0F526F4ULL,
+        0x71DCACB423B1F1B9ULL, 0x9CA58FE82189DC1AULL, 0x589F6AB3BA7A8922ULL, 0xAB2CAAD7FBE874B0ULL,
+        0x4C09F828B0268859ULL, 0x9C0A842FDFFDF309ULL, 0x0F49E3901401EAAFULL, 0x1EF984DF4C72A2BAULL,
+        0x7D29DDA0E8EBA97FULL, 0xB06936C36525C1EDULL, 0xE63A1D97B0FE512EULL, 0x507D2E032636260CULL,
+        0x94F6E234FBB24940ULL, 0x73517246CC5B7DD2ULL, 0x6C97E9D7C7F4FFA9ULL, 0x06985E68B29DDC16ULL,
+        0xC8191CB13B51222EULL, 0xA10177F93EFECBEAULL, 0xD7ECF81FB3B68CFDULL, 0xE895B1AF4DA57EA4ULL,
+        0x6F4AB3C1EF071D59ULL, 0xEF3A765784F36523ULL, 0x6F3B90CB2DD5AB29ULL, 0x7C2E4798AFFFEA3FULL,
+        0x6433D0F9684B7A2BULL, 0x56076A0BEB3E061FULL, 0x8CB57C16C80C1DD3ULL, 0xB7CB001F47711128ULL,
+        0x2426761DF58AB90AULL, 0xED4BF4E0A61EAEF8ULL, 0x0D3625AF6E6C2DA5ULL, 0x57F493EC57733CBEULL,
+        0xD262623A5E0B3547ULL, 0x5848FE0DEB0892EDULL, 0xE4D210A511B79888ULL, 0xD866B5316E11D5B9ULL,
+        0x3D587DDDC2ABB852ULL, 0x36814B96D38EBBA2ULL, 0xF245E322D6590E55ULL, 0xBB89B263366E8909ULL,
+        0x32D12A05D637365BULL, 0x707BDED9EB73AEF7ULL, 0x4F564150D944146AULL, 0xC3EBF43126FAC6C2ULL,
+        0xAA884EF22540C3CFULL, 0xEE8DB4C82A535188ULL, 0x696611246EB4952BULL, 0x99822A18B46BD6C1ULL,
+        0xA0A174B1C776912CULL, 0xCAA47434C565B70EULL, 0x16282F87BCA37FE0ULL, 0xC0B8805076C7C11FULL,
+        0x0638D4664D43E95DULL, 0xF7662DE49F9699CFULL, 0x246BCB062E4E273CULL, 0x6C15F22B9D98F472ULL,
+        0x92C344BA8024991AULL, 0x828E62D4C271D6A8ULL, 0xE896C9C4F35F9F05ULL, 0x27CDB67CDC48417BULL,
+        0xC37C5631E1BDEF39ULL, 0x748DBF16A5AC7AA7ULL, 0xA8016C2EBB896B92ULL, 0xE0DDE184925CDDC5ULL,
+        0x0E0586C7FD8BB53EULL, 0x38A80FF03D922DD4ULL, 0x71815DE305C6FC8FULL, 0xD4CB9CE6088FB2B6ULL,
+        0x4081D1059182C053ULL, 0x39B365C4C03DB113ULL, 0x81D00BDF2D91EEB1ULL, 0xF2C92D7F483F412CULL,
+        0xC528AB45B806F4AEULL, 0xE91B44C1C9D012C7ULL, 0x7680033FFA5BE322ULL, 0x1112EDEBD7FBDC64ULL,
+    },
+};
+
+const uint64_t zobrist_half_moves[ZOBRIST_MAX_HALF_MOVES] = {
+    0xDC43C265E097B2DCULL, 0x64509148AD93AAB9ULL, 0x99732D192A2D03ACULL, 0xADB1CED4561A32ABULL,
+    0xB07DEE40A673CC0EULL, 0x2F5915E01261E816ULL, 0xB6F833F8ABB1EE46ULL, 0xE0613E683361DC1AULL,
+    0x06CB6192B2B75922ULL, 0xE17B67EBAF003F10ULL, 0xB0C26148496FFB6EULL, 0x80784469035E3F18ULL,
+    0x94710CA24BF84566ULL, 0xAA237CF2A10A2C6CULL, 0x6132D41F0526A334ULL, 0x96631B17E006A372ULL,
+    0x3D59D0D97F6832B4ULL, 0xF2D859538E6ECFD1ULL, 0x619F1AB8E727C60EULL, 0xAF6CD9E333DDCA02ULL,
+    0x09F769F6D9A4B116ULL, 0xA64FB79530F17DF4ULL, 0x874C794ACD6F620FULL, 0xDD38347F517ADF0BULL,
+    0xB9D9E4F1BA648875ULL, 0x3C79FE63A976FC25ULL, 0xC30538649D25B89DULL, 0x15EEEC53433A74ACULL,
+    0x538C8655333EAB45ULL, 0x9A25AB47CD3CA753ULL, 0xBF98FA8F4CDF6ADDULL, 0xA3ED90BD0E57C348ULL,
+    0x9BF3F6B0644EBECEULL, 0x8774302D60965033ULL, 0xFF7CD48DF5631053ULL, 0x04CD187A9121A2B3ULL,
+    0x3B19FEB042512D36ULL, 0xD6E94F6796E002ECULL, 0x937A75E11242F9E9ULL, 0x6A71E4CC5351265AULL,
+    0x2AB3C8919E595296ULL, 0x225EBA6B0A0585B3ULL, 0x0DC22710E9368278ULL, 0xBD36D054B7F3717CULL,
+    0x1BBD26F91D53489EULL, 0x3CAF6409C1B6098FULL, 0xD080FD8AB23EE65CULL, 0x5F9A20CBED088C90ULL,
+    0xAC1409175A71B989ULL, 0x325730A9EEEE18BAULL, 0xC737022B91B4AA0BULL, 0x0EC6E9057DC2219FULL,
+    0xC6210D3407BA221CULL, 0xE3F9082467CE5158ULL, 0x3CD052A9214A9BFAULL, 0xCE3299CE124BB04DULL,
+    0x065198254250946DULL, 0x012086F692768E05ULL, 0x41FFCE73B7834259ULL, 0x0EA46B1D3D4DF29DULL,
+    0x049B971D36686E38ULL, 0xF5F3F603FA1030E4ULL, 0x568311BA2CFEA985ULL, 0x4DC658F699119596ULL,
+    0xF2533F2B248E133DULL, 0xFA8611455392605BULL, 0xF45D050D1510325BULL, 0xE995C41B8483E4FFULL,
+    0x6271463A96003CF6ULL, 0xBB85B1A8E6A3C10FULL, 0x95E703582D25254DULL, 0x4885FFCE48119C47ULL,
+    0x6BD1087D7E104EBFULL, 0x7FAB08A04AEC21E2ULL, 0xE17E1565B70FC121ULL, 0x2E1389A82A73B6E3ULL,
+    0xDC67E1D2828A894EULL, 0x35DCA2E8CBBC0FDCULL, 0xD112514E755500C3ULL, 0x4BBBD114E8E3FA02ULL,
+    0xCCDB73897C60FD76ULL, 0xB295DAAE2B11A10CULL, 0x363491EF0592414EULL, 0x623E8DFE1BB8F64CULL,
+    0x2ACE62E33E3B94A0ULL, 0xA50329439324CB89ULL, 0xDA898513C4FD405EULL, 0xBF114229AE936D5EULL,
+    0x2852B6698CB6DC04ULL, 0x0F83EBC0C8E030BCULL, 0x786CEBEDC8D05FDDULL, 0x047F29097CE9A822ULL,
+    0x95AE7865069A33F2ULL, 0x6019C5CC5A4FBB15ULL, 0x442042F624314123ULL, 0xBA1FA366FACF0B61ULL,
+    0x7B6151EFBFFA6D37ULL, 0x6F47B82CBBE2342DULL, 0xCF6E1234EA975B05ULL, 0xB1C34590E41214F3ULL,
+    0xAF82BC225BF56C1AULL,
+};